@@ -0,0 +1,179 @@
+/*
+### Engine Parallel Bulk Algorithms
+
+The transform/accumulate loops in 2_vector/vector_functions.cpp run
+on one core. These helpers run the same loops across the work-stealing
+pool from engine_thread_pool.h:
+
+1. parallel_transform(pool, in, out, n, fn, grain) — out[i] = fn(in[i]),
+   chunked by a cache-friendly grain so each worker streams contiguous
+   memory instead of ping-ponging cache lines
+2. parallel_reduce(pool, data, n, identity, combine, grain) — each
+   chunk folds locally, then the partial results TREE-COMBINE:
+   pairwise rounds, so the final combine depth is log2(chunks) rather
+   than a serial chain
+3. parallel_sort(pool, data, n) — one sorted run per worker, then
+   parallel pairwise inplace_merge rounds until one run remains
+4. parallel_first_touch(pool, data, n, grain) — touches pages with
+   the SAME grain mapping the processing passes use. On first-touch
+   NUMA systems each page lands on the node of the worker that will
+   stream it; on single-socket machines it simply pre-faults pages
+   off the timed path.
+
+Grain choice: big enough that per-chunk overhead (one future, one
+deque hop) vanishes, small enough that stealing can balance — 64K
+elements is a good default for plain arithmetic on numeric types.
+*/
+
+#ifndef ENGINE_PARALLEL_H
+#define ENGINE_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <future>
+#include <vector>
+
+#include "engine_thread_pool.h"
+
+namespace Engine
+{
+    constexpr std::size_t DEFAULT_GRAIN = 65536;
+
+    template<typename In, typename Out, typename Fn>
+    void parallel_transform(ThreadPool& pool, const In* in, Out* out,
+                            std::size_t n, Fn fn,
+                            std::size_t grain = DEFAULT_GRAIN)
+    {
+        pool.parallel_for(0, n, grain, [in, out, fn](std::size_t i) {
+            out[i] = fn(in[i]);
+        });
+    }
+
+    // Acc deduces from the identity (like std::accumulate's init), so
+    // summing ints into a long long works without narrowing. As with
+    // std::reduce, combine must accept (Acc, T) for the chunk folds
+    // AND (Acc, Acc) for the tree phase — a generic lambda covers both
+    template<typename T, typename Acc, typename Fn>
+    Acc parallel_reduce(ThreadPool& pool, const T* data, std::size_t n,
+                        Acc identity, Fn combine,
+                        std::size_t grain = DEFAULT_GRAIN)
+    {
+        if (n == 0) return identity;
+
+        // Phase 1: one local fold per chunk, in parallel
+        std::size_t chunkCount = (n + grain - 1) / grain;
+        std::vector<std::future<Acc>> folds;
+        folds.reserve(chunkCount);
+        for (std::size_t c = 0; c < chunkCount; ++c)
+        {
+            std::size_t lo = c * grain;
+            std::size_t hi = std::min(lo + grain, n);
+            folds.push_back(pool.submit([data, lo, hi, identity, combine]() {
+                Acc partial = identity;
+                for (std::size_t i = lo; i < hi; ++i)
+                {
+                    partial = combine(partial, data[i]);
+                }
+                return partial;
+            }));
+        }
+
+        std::vector<Acc> partials;
+        partials.reserve(chunkCount);
+        for (auto& f : folds)
+        {
+            partials.push_back(f.get());
+        }
+
+        // Phase 2: tree-combine — log2(chunks) rounds of pairing
+        while (partials.size() > 1)
+        {
+            std::size_t half = partials.size() / 2;
+            for (std::size_t i = 0; i < half; ++i)
+            {
+                partials[i] = combine(partials[2 * i], partials[2 * i + 1]);
+            }
+            if (partials.size() & 1)
+            {
+                partials[half] = partials.back();
+                partials.resize(half + 1);
+            }
+            else
+            {
+                partials.resize(half);
+            }
+        }
+        return partials.front();
+    }
+
+    template<typename T>
+    void parallel_sort(ThreadPool& pool, T* data, std::size_t n)
+    {
+        std::size_t runCount = pool.workerCount();
+        if (runCount < 2 || n < 2 * DEFAULT_GRAIN)
+        {
+            std::sort(data, data + n);
+            return;
+        }
+
+        // Phase 1: one sorted run per worker
+        std::size_t runLength = (n + runCount - 1) / runCount;
+        std::vector<std::size_t> bounds;
+        for (std::size_t lo = 0; lo < n; lo += runLength)
+        {
+            bounds.push_back(lo);
+        }
+        bounds.push_back(n);
+
+        std::vector<std::future<void>> sorts;
+        for (std::size_t r = 0; r + 1 < bounds.size(); ++r)
+        {
+            std::size_t lo = bounds[r], hi = bounds[r + 1];
+            sorts.push_back(pool.submit([data, lo, hi]() {
+                std::sort(data + lo, data + hi);
+            }));
+        }
+        for (auto& f : sorts) f.get();
+
+        // Phase 2: pairwise merge rounds — round k merges runs 2i and
+        // 2i+1 in parallel, halving the run count each time
+        while (bounds.size() > 2)
+        {
+            std::vector<std::future<void>> merges;
+            std::vector<std::size_t> nextBounds;
+            std::size_t r = 0;
+            for (; r + 2 < bounds.size(); r += 2)
+            {
+                std::size_t lo = bounds[r], mid = bounds[r + 1], hi = bounds[r + 2];
+                nextBounds.push_back(lo);
+                merges.push_back(pool.submit([data, lo, mid, hi]() {
+                    std::inplace_merge(data + lo, data + mid, data + hi);
+                }));
+            }
+            if (r + 1 < bounds.size())
+            {
+                nextBounds.push_back(bounds[r]);    // odd run carries over
+            }
+            nextBounds.push_back(n);
+            for (auto& f : merges) f.get();
+            bounds = std::move(nextBounds);
+        }
+    }
+
+    // First-touch placement: fault every page in from the worker that
+    // the processing passes will assign it to (same grain, same
+    // round-robin order). On NUMA boxes the page lands on that
+    // worker's node; everywhere else it pre-faults off the hot path.
+    template<typename T>
+    void parallel_first_touch(ThreadPool& pool, T* data, std::size_t n,
+                              std::size_t grain = DEFAULT_GRAIN)
+    {
+        pool.parallel_for(0, n, grain, [data](std::size_t i) {
+            data[i] = T{};
+        });
+    }
+
+} // namespace Engine
+
+#endif // ENGINE_PARALLEL_H
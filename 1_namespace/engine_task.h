@@ -0,0 +1,371 @@
+/*
+### Engine::Task — Structured Async on Coroutines (C++20)
+
+The thread pool in engine_thread_pool.h runs opaque callables; an
+ingestion flow (read -> parse -> index -> store) written against it
+still blocks a thread in every I/O wait. This header adds the
+structured pieces:
+
+1. Task<T> — a lazy coroutine task. Nothing runs until awaited or
+   started; co_await task chains continuations with symmetric
+   transfer instead of blocking; syncWait() bridges back to normal
+   code at the top of the world
+2. Channel<T> — the bounded SPSC hand-off between stages. Same ring
+   discipline as the SpscRingBuffer in
+   6_pointers/concurrent_ring_buffer.cpp (atomic head/tail,
+   acquire/release publishing, padding against false sharing), but
+   read()/write() are AWAITABLE: a full channel suspends the writer,
+   an empty one suspends the reader — that suspension IS the
+   backpressure. A slow store stage fills its input channel, which
+   suspends index, which fills ITS input, all the way back to read.
+   Memory in flight is capacity x stages, fixed at build time
+3. Pipeline — declares stages as coroutines, gives each its own
+   driver thread, and wires the channels. A stage suspended on a
+   channel costs a poll-and-yield, not a blocked syscall, and the
+   stages overlap: while store waits on its device, parse and index
+   keep the CPU busy
+
+Drivers poll a readiness probe the awaiter leaves behind rather than
+parking on a kernel object — stage wake-ups are decided by two atomic
+loads, which is the right trade for queues that are rarely empty.
+*/
+
+#ifndef ENGINE_TASK_H
+#define ENGINE_TASK_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+    // Set by a channel awaiter when its stage suspends; the stage's
+    // driver thread polls it to decide when resuming is worthwhile.
+    // thread_local works because each stage runs on its own driver.
+    inline thread_local std::function<bool()> stageReadyProbe;
+
+    // ### Task<T>: lazy coroutine with continuation chaining
+    template<typename T>
+    class Task
+    {
+    public:
+        struct promise_type
+        {
+            T value{};
+            std::exception_ptr error;
+            std::coroutine_handle<> continuation;
+
+            Task get_return_object()
+            {
+                return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            std::suspend_always initial_suspend() { return {}; }
+
+            // On completion, hand the CPU straight to whoever awaited
+            // us (symmetric transfer — no stack growth, no scheduler)
+            struct FinalAwaiter
+            {
+                bool await_ready() noexcept { return false; }
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> self) noexcept
+                {
+                    auto next = self.promise().continuation;
+                    return next ? next : std::noop_coroutine();
+                }
+                void await_resume() noexcept {}
+            };
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void return_value(T v) { value = std::move(v); }
+            void unhandled_exception() { error = std::current_exception(); }
+        };
+
+        explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+        Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            if (handle) handle.destroy();
+        }
+
+        bool await_ready() const { return false; }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter)
+        {
+            handle.promise().continuation = awaiter;
+            return handle;                      // start the child now
+        }
+
+        T await_resume()
+        {
+            if (handle.promise().error)
+            {
+                std::rethrow_exception(handle.promise().error);
+            }
+            return std::move(handle.promise().value);
+        }
+
+        // Bridge for non-coroutine callers: drive to completion here
+        T syncWait()
+        {
+            handle.resume();
+            while (!handle.done())
+            {
+                std::this_thread::yield();
+            }
+            return await_resume();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    // void specialization: same shape, no value slot
+    template<>
+    class Task<void>
+    {
+    public:
+        struct promise_type
+        {
+            std::exception_ptr error;
+            std::coroutine_handle<> continuation;
+
+            Task get_return_object()
+            {
+                return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            std::suspend_always initial_suspend() { return {}; }
+
+            struct FinalAwaiter
+            {
+                bool await_ready() noexcept { return false; }
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> self) noexcept
+                {
+                    auto next = self.promise().continuation;
+                    return next ? next : std::noop_coroutine();
+                }
+                void await_resume() noexcept {}
+            };
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void return_void() {}
+            void unhandled_exception() { error = std::current_exception(); }
+        };
+
+        explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+        Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            if (handle) handle.destroy();
+        }
+
+        bool await_ready() const { return false; }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter)
+        {
+            handle.promise().continuation = awaiter;
+            return handle;
+        }
+
+        void await_resume()
+        {
+            if (handle.promise().error)
+            {
+                std::rethrow_exception(handle.promise().error);
+            }
+        }
+
+        void start() { handle.resume(); }
+        bool done() const { return handle.done(); }
+
+        std::coroutine_handle<promise_type> raw() const { return handle; }
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    // ### Channel<T>: awaitable bounded SPSC ring
+    template<typename T>
+    class Channel
+    {
+    private:
+        static constexpr std::size_t CACHE_LINE = 64;
+
+        std::vector<T> slots;
+        std::size_t mask;
+        alignas(CACHE_LINE) std::atomic<std::size_t> head{0};   // consumer
+        alignas(CACHE_LINE) std::atomic<std::size_t> tail{0};   // producer
+        std::atomic<bool> closed{false};
+
+        static std::size_t roundUpPow2(std::size_t n)
+        {
+            std::size_t p = 1;
+            while (p < n) p *= 2;
+            return p;
+        }
+
+    public:
+        explicit Channel(std::size_t capacity)
+            : slots(roundUpPow2(capacity)), mask(slots.size() - 1)
+        {
+        }
+
+        bool full() const
+        {
+            return tail.load(std::memory_order_relaxed)
+                 - head.load(std::memory_order_acquire) > mask;
+        }
+
+        bool empty() const
+        {
+            return head.load(std::memory_order_relaxed)
+                 == tail.load(std::memory_order_acquire);
+        }
+
+        void close() { closed.store(true, std::memory_order_release); }
+        bool isClosed() const { return closed.load(std::memory_order_acquire); }
+
+        // drained = closed AND nothing left to read
+        bool drained() const { return isClosed() && empty(); }
+
+        // co_await channel.write(x): suspends while full (backpressure).
+        // SPSC makes the re-check in await_resume safe: only this
+        // coroutine writes, and space only ever GROWS underneath it.
+        struct WriteAwaiter
+        {
+            Channel& channel;
+            T value;
+
+            bool await_ready()
+            {
+                return !channel.full();
+            }
+
+            bool await_suspend(std::coroutine_handle<>)
+            {
+                stageReadyProbe = [c = &channel] { return c->writableNow(); };
+                return channel.full();          // stay suspended only if still full
+            }
+
+            void await_resume()
+            {
+                std::size_t t = channel.tail.load(std::memory_order_relaxed);
+                channel.slots[t & channel.mask] = std::move(value);
+                channel.tail.store(t + 1, std::memory_order_release);
+            }
+        };
+
+        WriteAwaiter write(T value)
+        {
+            return WriteAwaiter{*this, std::move(value)};
+        }
+
+        // co_await channel.read(): yields {value, valid}; valid=false
+        // means the channel was closed and fully drained
+        struct ReadResult
+        {
+            T value{};
+            bool valid = false;
+        };
+
+        struct ReadAwaiter
+        {
+            Channel& channel;
+
+            bool await_ready()
+            {
+                return !channel.empty() || channel.drained();
+            }
+
+            bool await_suspend(std::coroutine_handle<>)
+            {
+                stageReadyProbe = [c = &channel] { return c->readableNow(); };
+                return channel.empty() && !channel.drained();
+            }
+
+            ReadResult await_resume()
+            {
+                if (channel.empty())
+                {
+                    return ReadResult{};        // drained: end of stream
+                }
+                std::size_t h = channel.head.load(std::memory_order_relaxed);
+                ReadResult result{std::move(channel.slots[h & channel.mask]), true};
+                channel.head.store(h + 1, std::memory_order_release);
+                return result;
+            }
+        };
+
+        ReadAwaiter read()
+        {
+            return ReadAwaiter{*this};
+        }
+
+        // Can whoever is suspended on this channel make progress?
+        bool readableNow() const { return !empty() || drained(); }
+        bool writableNow() const { return !full(); }
+    };
+
+    // ### Pipeline: one driver thread per stage coroutine.
+    // Stages are expected to suspend only on Channel awaiters (which
+    // leave a readiness probe behind); a stage that co_awaits a
+    // sub-Task should do so only where the sub-Task runs to completion
+    // without external wake-ups.
+    class Pipeline
+    {
+    private:
+        std::vector<Task<void>> stages;
+        std::vector<std::thread> drivers;
+
+    public:
+        void addStage(Task<void> task)
+        {
+            stages.push_back(std::move(task));
+        }
+
+        // Run every stage to completion; returns when the last one is
+        // done. A stage that cannot advance yields its timeslice.
+        void run()
+        {
+            for (Task<void>& stage : stages)
+            {
+                drivers.emplace_back([&stage] {
+                    stageReadyProbe = nullptr;
+                    stage.start();
+                    while (!stage.done())
+                    {
+                        if (!stageReadyProbe || stageReadyProbe())
+                        {
+                            stage.raw().resume();
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            for (std::thread& driver : drivers)
+            {
+                driver.join();
+            }
+            drivers.clear();
+        }
+    };
+
+} // namespace Engine
+
+#endif // ENGINE_TASK_H
@@ -0,0 +1,210 @@
+/*
+### Engine::ThreadPool — Work-Stealing Thread Pool
+
+The Engine namespace (custom_namespace.cpp) is where runtime
+infrastructure lives, and until now all of it was single-threaded.
+This header adds the concurrency substrate the bulk operations build
+on:
+
+1. One task deque PER WORKER, not one shared queue — a shared queue
+   makes every submit and every pop fight over the same lock
+2. Work stealing: a worker pops its own deque from the back (newest
+   task, cache-warm), and when empty steals from another worker's
+   FRONT (oldest task, least likely to share state with the victim)
+3. submit() wraps the callable in a packaged_task and returns the
+   future, so callers get results and exceptions the standard way
+4. submit_on(worker, fn) is an affinity HINT: the task is queued on
+   that worker's deque, but another worker may still steal it —
+   affinity here means "run near this data", not pinning
+5. parallel_for(begin, end, grain, fn) chops [begin, end) into
+   chunks of `grain` indices and waits for all of them
+
+Workers sleep on a condition variable when every deque is empty, so
+an idle pool costs nothing.
+*/
+
+#ifndef ENGINE_THREAD_POOL_H
+#define ENGINE_THREAD_POOL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+namespace Engine
+{
+    class ThreadPool
+    {
+    private:
+        // Each worker owns one of these; the mutex only contends when
+        // a thief and the owner touch the same deque at once
+        struct Worker
+        {
+            std::deque<std::function<void()>> tasks;
+            std::mutex guard;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::vector<std::thread> threads;
+
+        std::mutex sleepGuard;
+        std::condition_variable wakeup;
+        std::atomic<size_t> pendingTasks{0};
+        std::atomic<size_t> nextQueue{0};   // round-robin for plain submit
+        std::atomic<bool> stopping{false};
+
+        // Which worker the current thread is; -1 on non-pool threads
+        static thread_local int currentWorker;
+
+        // Own deque from the back; steal from other fronts
+        bool tryGetTask(size_t self, std::function<void()>& out)
+        {
+            {
+                std::lock_guard<std::mutex> lock(workers[self]->guard);
+                if (!workers[self]->tasks.empty())
+                {
+                    out = std::move(workers[self]->tasks.back());
+                    workers[self]->tasks.pop_back();
+                    return true;
+                }
+            }
+
+            for (size_t i = 1; i < workers.size(); ++i)
+            {
+                size_t victim = (self + i) % workers.size();
+                std::lock_guard<std::mutex> lock(workers[victim]->guard);
+                if (!workers[victim]->tasks.empty())
+                {
+                    out = std::move(workers[victim]->tasks.front());
+                    workers[victim]->tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void workerLoop(size_t self)
+        {
+            currentWorker = (int)self;
+            while (true)
+            {
+                std::function<void()> task;
+                if (tryGetTask(self, task))
+                {
+                    pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+                    task();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleepGuard);
+                wakeup.wait(lock, [this]() {
+                    return pendingTasks.load(std::memory_order_relaxed) > 0 ||
+                           stopping.load(std::memory_order_relaxed);
+                });
+                if (stopping.load(std::memory_order_relaxed) &&
+                    pendingTasks.load(std::memory_order_relaxed) == 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        void enqueue(size_t queue, std::function<void()> task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(workers[queue]->guard);
+                workers[queue]->tasks.push_back(std::move(task));
+            }
+            pendingTasks.fetch_add(1, std::memory_order_relaxed);
+            wakeup.notify_one();
+        }
+
+    public:
+        explicit ThreadPool(size_t workerCount = std::thread::hardware_concurrency())
+        {
+            if (workerCount == 0) workerCount = 1;
+            for (size_t i = 0; i < workerCount; ++i)
+            {
+                workers.push_back(std::make_unique<Worker>());
+            }
+            for (size_t i = 0; i < workerCount; ++i)
+            {
+                threads.emplace_back([this, i]() { workerLoop(i); });
+            }
+        }
+
+        ~ThreadPool()
+        {
+            stopping.store(true);
+            wakeup.notify_all();
+            for (auto& t : threads) t.join();
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t workerCount() const { return workers.size(); }
+
+        // Index of the worker running the calling thread, -1 outside
+        // the pool — lets tasks report where they actually ran
+        static int runningOn() { return currentWorker; }
+
+        // Queue on the next worker round-robin; returns the result
+        // (or exception) through a future
+        template<typename Fn>
+        auto submit(Fn&& fn) -> std::future<decltype(fn())>
+        {
+            size_t queue = nextQueue.fetch_add(1, std::memory_order_relaxed)
+                           % workers.size();
+            return submit_on(queue, std::forward<Fn>(fn));
+        }
+
+        // Affinity hint: queue on a specific worker's deque. The task
+        // runs there unless that worker is busy and someone steals it.
+        template<typename Fn>
+        auto submit_on(size_t worker, Fn&& fn) -> std::future<decltype(fn())>
+        {
+            using Result = decltype(fn());
+            auto task = std::make_shared<std::packaged_task<Result()>>(
+                std::forward<Fn>(fn));
+            std::future<Result> result = task->get_future();
+            enqueue(worker % workers.size(), [task]() { (*task)(); });
+            return result;
+        }
+
+        // Data-parallel loop: fn(i) for every i in [begin, end),
+        // submitted in chunks of `grain` indices. Blocks until done.
+        template<typename Fn>
+        void parallel_for(size_t begin, size_t end, size_t grain, Fn fn)
+        {
+            if (grain == 0) grain = 1;
+
+            std::vector<std::future<void>> chunks;
+            for (size_t lo = begin; lo < end; lo += grain)
+            {
+                size_t hi = std::min(lo + grain, end);
+                chunks.push_back(submit([lo, hi, fn]() {
+                    for (size_t i = lo; i < hi; ++i)
+                    {
+                        fn(i);
+                    }
+                }));
+            }
+            for (auto& chunk : chunks)
+            {
+                chunk.get();        // rethrows if a chunk threw
+            }
+        }
+    };
+
+    inline thread_local int ThreadPool::currentWorker = -1;
+
+} // namespace Engine
+
+#endif // ENGINE_THREAD_POOL_H
@@ -47,9 +47,44 @@ syntax:
         // declarations - file-local
     }
 
+
+### Reopening a Namespace: Math Array Kernels
+- The Math namespace is defined twice in this file: first the scalar
+  helpers, then reopened with array-level kernels — the same mechanism
+  that lets one namespace span many files.
+- The kernels (sum, saxpy, min_max, normalize) process whole float
+  arrays per call instead of one value per call, so tight loops stop
+  paying per-element call overhead.
+- Each kernel has an SSE2 body (4 floats/op, baseline on x86-64), an
+  AVX2 body (8 floats/op) selected once at runtime via CPUID, and a
+  portable scalar fallback for non-x86 builds.
+
+
+### Reopening a Namespace: Zero-Allocation String Operations
+- String is likewise reopened with string_view-based operations: the
+  inputs are views, the outputs go to caller-provided buffers or
+  callbacks, so nothing on this path allocates.
+- to_upper and find process 16 bytes per step with SSE2; split hands
+  each piece to a callback as a string_view into the original buffer.
+- String::SmallString<N> stores up to N-1 characters inline and only
+  touches the heap for the rare long string.
+
 */
 
 #include <iostream>
+#include <cmath>
+#include <cfloat>
+#include <cstddef>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define HAS_X86_SIMD 1
+#endif
 
 // Multiple namespaces
 namespace Math
@@ -73,6 +108,303 @@ namespace String
     }
 }
 
+// Math reopened: array-level kernels join the scalar helpers above.
+// One namespace, two definition blocks — exactly how a namespace
+// spans multiple files in a real library.
+namespace Math
+{
+#if defined(HAS_X86_SIMD) && defined(__GNUC__)
+    __attribute__((target("avx2")))
+    float sumAvx2(const float *a, std::size_t n)
+    {
+        __m256 acc = _mm256_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            acc = _mm256_add_ps(acc, _mm256_loadu_ps(a + i));
+        }
+        float lanes[8];
+        _mm256_storeu_ps(lanes, acc);
+        float total = lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                      lanes[4] + lanes[5] + lanes[6] + lanes[7];
+        for (; i < n; ++i) total += a[i];
+        return total;
+    }
+
+    __attribute__((target("avx2")))
+    void saxpyAvx2(float alpha, const float *x, float *y, std::size_t n)
+    {
+        __m256 va = _mm256_set1_ps(alpha);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256 vy = _mm256_loadu_ps(y + i);
+            __m256 vx = _mm256_loadu_ps(x + i);
+            _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_mul_ps(va, vx), vy));
+        }
+        for (; i < n; ++i) y[i] = alpha * x[i] + y[i];
+    }
+
+    bool haveAvx2()
+    {
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+#else
+    bool haveAvx2() { return false; }
+#endif
+
+    // Sum of an array. SSE2 is the x86-64 baseline, so the 4-wide
+    // body needs no dispatch; AVX2 doubles the lane count when the
+    // CPU has it.
+    float sum(const float *a, std::size_t n)
+    {
+#if defined(HAS_X86_SIMD) && defined(__GNUC__)
+        if (haveAvx2()) return sumAvx2(a, n);
+        __m128 acc = _mm_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            acc = _mm_add_ps(acc, _mm_loadu_ps(a + i));
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, acc);
+        float total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        for (; i < n; ++i) total += a[i];
+        return total;
+#else
+        float total = 0;
+        for (std::size_t i = 0; i < n; ++i) total += a[i];
+        return total;
+#endif
+    }
+
+    // y[i] = alpha * x[i] + y[i] — the classic BLAS saxpy
+    void saxpy(float alpha, const float *x, float *y, std::size_t n)
+    {
+#if defined(HAS_X86_SIMD) && defined(__GNUC__)
+        if (haveAvx2()) { saxpyAvx2(alpha, x, y, n); return; }
+        __m128 va = _mm_set1_ps(alpha);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 vy = _mm_loadu_ps(y + i);
+            __m128 vx = _mm_loadu_ps(x + i);
+            _mm_storeu_ps(y + i, _mm_add_ps(_mm_mul_ps(va, vx), vy));
+        }
+        for (; i < n; ++i) y[i] = alpha * x[i] + y[i];
+#else
+        for (std::size_t i = 0; i < n; ++i) y[i] = alpha * x[i] + y[i];
+#endif
+    }
+
+    // Min and max in one pass
+    void min_max(const float *a, std::size_t n, float &outMin, float &outMax)
+    {
+        outMin = FLT_MAX;
+        outMax = -FLT_MAX;
+#if defined(HAS_X86_SIMD) && defined(__GNUC__)
+        __m128 mn = _mm_set1_ps(FLT_MAX);
+        __m128 mx = _mm_set1_ps(-FLT_MAX);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 v = _mm_loadu_ps(a + i);
+            mn = _mm_min_ps(mn, v);
+            mx = _mm_max_ps(mx, v);
+        }
+        float mnLanes[4], mxLanes[4];
+        _mm_storeu_ps(mnLanes, mn);
+        _mm_storeu_ps(mxLanes, mx);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            if (mnLanes[lane] < outMin) outMin = mnLanes[lane];
+            if (mxLanes[lane] > outMax) outMax = mxLanes[lane];
+        }
+        for (; i < n; ++i)
+        {
+            if (a[i] < outMin) outMin = a[i];
+            if (a[i] > outMax) outMax = a[i];
+        }
+#else
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (a[i] < outMin) outMin = a[i];
+            if (a[i] > outMax) outMax = a[i];
+        }
+#endif
+    }
+
+    // Scale the array to unit L2 norm, built from the kernels above
+    void normalize(float *a, std::size_t n)
+    {
+        double squares = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            squares += (double)a[i] * a[i];
+        }
+        float norm = (float)std::sqrt(squares);
+        if (norm == 0.0f) return;
+
+        // a = (1/norm - 1) * a + a  ==  a / norm
+        saxpy(1.0f / norm - 1.0f, a, a, n);
+    }
+}
+
+// String reopened: zero-allocation operations. Inputs are views,
+// outputs go to caller buffers or callbacks — nothing here allocates.
+namespace String
+{
+    // Uppercase `in` into `out` (caller provides out, >= in.size()).
+    // SSE2 body: 16 bytes per step; a lane is lowercase iff it sits
+    // in ['a','z'], and those lanes get bit 0x20 cleared.
+    void to_upper(std::string_view in, char *out)
+    {
+        std::size_t i = 0;
+#if defined(HAS_X86_SIMD)
+        __m128i lowerA = _mm_set1_epi8('a' - 1);
+        __m128i lowerZ = _mm_set1_epi8('z' + 1);
+        __m128i caseBit = _mm_set1_epi8(0x20);
+        for (; i + 16 <= in.size(); i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i *)(in.data() + i));
+            __m128i isLower = _mm_and_si128(_mm_cmpgt_epi8(v, lowerA),
+                                            _mm_cmpgt_epi8(lowerZ, v));
+            v = _mm_sub_epi8(v, _mm_and_si128(isLower, caseBit));
+            _mm_storeu_si128((__m128i *)(out + i), v);
+        }
+#endif
+        for (; i < in.size(); ++i)
+        {
+            char c = in[i];
+            out[i] = (c >= 'a' && c <= 'z') ? (char)(c - 0x20) : c;
+        }
+    }
+
+    // First occurrence of `needle` in `haystack`, npos if absent.
+    // SSE2 scans 16 candidate positions per step for the first byte,
+    // then verifies only where that byte matched.
+    std::size_t find(std::string_view haystack, std::string_view needle)
+    {
+        if (needle.empty()) return 0;
+        if (needle.size() > haystack.size()) return std::string_view::npos;
+
+        std::size_t last = haystack.size() - needle.size();
+        std::size_t i = 0;
+#if defined(HAS_X86_SIMD)
+        __m128i first = _mm_set1_epi8(needle[0]);
+        for (; i + 16 <= last + 1; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i *)(haystack.data() + i));
+            int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, first));
+            while (mask != 0)
+            {
+                int bit = __builtin_ctz(mask);
+                mask &= mask - 1;
+                std::size_t pos = i + (std::size_t)bit;
+                if (pos <= last &&
+                    std::memcmp(haystack.data() + pos, needle.data(), needle.size()) == 0)
+                {
+                    return pos;
+                }
+            }
+        }
+#endif
+        for (; i <= last; ++i)
+        {
+            if (haystack[i] == needle[0] &&
+                std::memcmp(haystack.data() + i, needle.data(), needle.size()) == 0)
+            {
+                return i;
+            }
+        }
+        return std::string_view::npos;
+    }
+
+    // Call fn(piece) for every separator-delimited piece. Each piece
+    // is a view into the original buffer — zero copies, zero heap.
+    template<typename Fn>
+    void split(std::string_view in, char separator, Fn fn)
+    {
+        std::size_t start = 0;
+        while (start <= in.size())
+        {
+            std::size_t sep = find(in.substr(start), std::string_view(&separator, 1));
+            if (sep == std::string_view::npos)
+            {
+                fn(in.substr(start));
+                return;
+            }
+            fn(in.substr(start, sep));
+            start += sep + 1;
+        }
+    }
+
+    // Small-string type: up to N-1 characters live inline, the heap
+    // is only touched when a string outgrows that
+    template<std::size_t N>
+    class SmallString
+    {
+    private:
+        char inlineBuf[N];
+        char *heap = nullptr;
+        std::size_t len = 0;
+        std::size_t cap = N - 1;
+
+        char *buffer() { return heap ? heap : inlineBuf; }
+        const char *buffer() const { return heap ? heap : inlineBuf; }
+
+        void ensure(std::size_t needed)
+        {
+            if (needed <= cap) return;
+            std::size_t newCap = cap * 2 > needed ? cap * 2 : needed;
+            char *bigger = new char[newCap + 1];
+            std::memcpy(bigger, buffer(), len + 1);
+            delete[] heap;
+            heap = bigger;
+            cap = newCap;
+        }
+
+    public:
+        SmallString() { inlineBuf[0] = '\0'; }
+
+        SmallString(std::string_view sv) : SmallString()
+        {
+            append(sv);
+        }
+
+        SmallString(const SmallString &other) : SmallString()
+        {
+            append(other.view());
+        }
+
+        SmallString &operator=(const SmallString &other)
+        {
+            if (this != &other)
+            {
+                len = 0;
+                append(other.view());
+            }
+            return *this;
+        }
+
+        ~SmallString() { delete[] heap; }
+
+        void append(std::string_view sv)
+        {
+            ensure(len + sv.size());
+            std::memcpy(buffer() + len, sv.data(), sv.size());
+            len += sv.size();
+            buffer()[len] = '\0';
+        }
+
+        std::string_view view() const { return std::string_view(buffer(), len); }
+        const char *c_str() const { return buffer(); }
+        std::size_t size() const { return len; }
+        bool isInline() const { return heap == nullptr; }
+    };
+}
+
 // Nested namespaces
 namespace Company
 {
@@ -146,6 +478,117 @@ int main()
     cout << "Using declaration - add(5, 3) = " << add(5, 3) << endl;
     // cout << multiply(2, 3); // ERROR: multiply not in scope
     cout << "Still need namespace for multiply: Math::multiply(2, 3) = " << Math::multiply(2, 3) << endl;
+    cout << endl;
+
+    cout << "=== Reopened Namespace: Math Array Kernels ===" << endl;
+    {
+        cout << "SIMD dispatch: " << (Math::haveAvx2() ? "AVX2 (8 floats/op)" : "SSE2/scalar") << endl;
+
+        vector<float> v = {3.0f, -1.0f, 4.0f, 1.5f, -5.0f, 9.0f, 2.0f, -6.0f, 5.0f};
+        cout << "Math::sum: " << Math::sum(v.data(), v.size()) << endl;
+
+        float mn, mx;
+        Math::min_max(v.data(), v.size(), mn, mx);
+        cout << "Math::min_max: [" << mn << ", " << mx << "]" << endl;
+
+        vector<float> y = {1, 1, 1, 1, 1, 1, 1, 1, 1};
+        Math::saxpy(2.0f, v.data(), y.data(), y.size());
+        cout << "Math::saxpy(2, v, ones): y[0]=" << y[0] << " y[5]=" << y[5] << endl;
+
+        vector<float> unit = {3.0f, 4.0f};
+        Math::normalize(unit.data(), unit.size());
+        cout << "Math::normalize({3,4}): {" << unit[0] << ", " << unit[1]
+             << "} (norm 1)" << endl;
+
+        // The point of array-level kernels: one call per array beats
+        // a hand-written per-element loop at the call site
+        const size_t N = 8000000;
+        vector<float> big(N);
+        for (size_t i = 0; i < N; ++i) big[i] = (float)(i % 100) * 0.25f;
+
+        auto start = chrono::steady_clock::now();
+        float scalarTotal = 0;
+        for (size_t i = 0; i < N; ++i) scalarTotal += big[i];
+        auto scalarUs = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        float kernelTotal = Math::sum(big.data(), N);
+        auto kernelUs = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << N << " floats summed:" << endl;
+        cout << "  call-site scalar loop: " << scalarUs << " us (total "
+             << scalarTotal << ")" << endl;
+        cout << "  Math::sum kernel:      " << kernelUs << " us (total "
+             << kernelTotal << ")" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Reopened Namespace: Zero-Allocation String Operations ===" << endl;
+    {
+        string_view header = "content-type: application/json; charset=utf-8";
+
+        char upper[64];
+        String::to_upper(header, upper);
+        cout << "to_upper: " << string_view(upper, header.size()) << endl;
+
+        cout << "find(\"charset\"): index "
+             << String::find(header, "charset") << endl;
+        cout << "find(\"gzip\"): "
+             << (String::find(header, "gzip") == string_view::npos
+                 ? "npos (absent)" : "found") << endl;
+
+        cout << "split on ';':" << endl;
+        String::split(header, ';', [](string_view piece) {
+            cout << "  [" << piece << "]" << endl;
+        });
+
+        String::SmallString<32> name("host");
+        cout << "SmallString<32> \"" << name.c_str() << "\": "
+             << (name.isInline() ? "inline" : "heap")
+             << " (sizeof = " << sizeof(name) << ")" << endl;
+
+        name.append(".internal.example.com/very/long/path/component");
+        cout << "After growth to " << name.size() << " chars: "
+             << (name.isInline() ? "inline" : "heap") << endl;
+
+        // The allocation cost this removes: uppercase 1M short headers
+        // via std::string temporaries vs a reused caller buffer
+        const int HEADERS = 1000000;
+        string sample(header);
+
+        auto start = chrono::steady_clock::now();
+        size_t tempChars = 0;
+        for (int i = 0; i < HEADERS; ++i)
+        {
+            string temp;                    // one allocation per call
+            temp.reserve(sample.size());
+            for (char c : sample)
+            {
+                temp.push_back((c >= 'a' && c <= 'z') ? (char)(c - 0x20) : c);
+            }
+            tempChars += temp.size();
+        }
+        auto tempMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        size_t viewChars = 0;
+        for (int i = 0; i < HEADERS; ++i)
+        {
+            String::to_upper(sample, upper);
+            viewChars += sample.size();
+        }
+        auto viewMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << HEADERS << " headers uppercased:" << endl;
+        cout << "  std::string temporaries: " << tempMs << " ms ("
+             << tempChars << " chars)" << endl;
+        cout << "  view + caller buffer:    " << viewMs << " ms ("
+             << viewChars << " chars)" << endl;
+    }
 
     return 0;
 }
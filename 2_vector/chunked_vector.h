@@ -0,0 +1,206 @@
+/*
+### ChunkedVector<T> — Stable-Pointer Growth
+
+vector_add.cpp and vector_operations.cpp grow with push_back, and
+std::vector's doubling growth has two costs the examples don't show:
+every reallocation copies EVERYTHING it has (a multi-millisecond
+stall once the container is gigabytes), and every reallocation
+invalidates every pointer and iterator into it.
+
+ChunkedVector never relocates:
+1. Storage is a list of fixed-size CHUNKS (4096 elements, a power of
+   two so indexing is a shift and a mask)
+2. Append is O(1) always: either bump the count, or allocate ONE new
+   chunk — existing elements never move, so appends cost the same at
+   element 40 million as at element 40
+3. Element addresses are STABLE for the container's lifetime; holding
+   a T* across appends is safe
+4. Iteration is segmented: for_each_chunk() hands the caller a plain
+   (begin, end) pointer pair per chunk — the inner loop is a pointer
+   walk the compiler auto-vectorizes — and the range-for iterator
+   walks the same way, advancing a raw pointer until the chunk edge
+
+The trade: operator[] costs one extra indirection (chunk table, then
+chunk), and memory is allocated in 16KB steps.
+*/
+
+#ifndef CHUNKED_VECTOR_H
+#define CHUNKED_VECTOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+template<typename T>
+class ChunkedVector
+{
+public:
+    static constexpr std::size_t CHUNK_SHIFT = 12;
+    static constexpr std::size_t CHUNK_SIZE = (std::size_t)1 << CHUNK_SHIFT;   // 4096
+    static constexpr std::size_t CHUNK_MASK = CHUNK_SIZE - 1;
+
+private:
+    struct ChunkDeleter
+    {
+        void operator()(T* chunk) const
+        {
+            ::operator delete((void*)chunk, std::align_val_t(alignof(T)));
+        }
+    };
+    using ChunkPtr = std::unique_ptr<T, ChunkDeleter>;
+
+    std::vector<ChunkPtr> chunks;
+    std::size_t count = 0;
+
+    static ChunkPtr allocateChunk()
+    {
+        return ChunkPtr((T*)::operator new(CHUNK_SIZE * sizeof(T),
+                                           std::align_val_t(alignof(T))));
+    }
+
+public:
+    ChunkedVector() = default;
+
+    ~ChunkedVector()
+    {
+        clear();
+    }
+
+    ChunkedVector(const ChunkedVector&) = delete;
+    ChunkedVector& operator=(const ChunkedVector&) = delete;
+
+    ChunkedVector(ChunkedVector&& other) noexcept
+        : chunks(std::move(other.chunks)), count(other.count)
+    {
+        other.count = 0;
+    }
+
+    // O(1) always: bump, or allocate one 16KB chunk. Nothing moves.
+    void push_back(const T& value)
+    {
+        if ((count & CHUNK_MASK) == 0 && count >> CHUNK_SHIFT == chunks.size())
+        {
+            chunks.push_back(allocateChunk());
+        }
+        new (&chunks[count >> CHUNK_SHIFT].get()[count & CHUNK_MASK]) T(value);
+        ++count;
+    }
+
+    void push_back(T&& value)
+    {
+        if ((count & CHUNK_MASK) == 0 && count >> CHUNK_SHIFT == chunks.size())
+        {
+            chunks.push_back(allocateChunk());
+        }
+        new (&chunks[count >> CHUNK_SHIFT].get()[count & CHUNK_MASK]) T(std::move(value));
+        ++count;
+    }
+
+    void pop_back()
+    {
+        --count;
+        chunks[count >> CHUNK_SHIFT].get()[count & CHUNK_MASK].~T();
+    }
+
+    // One extra indirection vs std::vector — the price of stability
+    T& operator[](std::size_t index)
+    {
+        return chunks[index >> CHUNK_SHIFT].get()[index & CHUNK_MASK];
+    }
+
+    const T& operator[](std::size_t index) const
+    {
+        return chunks[index >> CHUNK_SHIFT].get()[index & CHUNK_MASK];
+    }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    std::size_t chunkCount() const { return chunks.size(); }
+
+    void reserve(std::size_t capacity)
+    {
+        std::size_t needed = (capacity + CHUNK_MASK) >> CHUNK_SHIFT;
+        while (chunks.size() < needed)
+        {
+            chunks.push_back(allocateChunk());
+        }
+    }
+
+    void clear()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            chunks[i >> CHUNK_SHIFT].get()[i & CHUNK_MASK].~T();
+        }
+        count = 0;
+        chunks.clear();
+    }
+
+    // Segmented bulk iteration: fn(begin, end) per chunk. The inner
+    // loop over [begin, end) is a plain pointer walk — vectorizable.
+    template<typename Fn>
+    void for_each_chunk(Fn fn) const
+    {
+        std::size_t remaining = count;
+        for (const ChunkPtr& chunk : chunks)
+        {
+            if (remaining == 0) break;
+            std::size_t inThisChunk = remaining < CHUNK_SIZE ? remaining : CHUNK_SIZE;
+            fn(chunk.get(), chunk.get() + inThisChunk);
+            remaining -= inThisChunk;
+        }
+    }
+
+    // Segmented iterator for range-for: ++ is a pointer bump until
+    // the chunk edge, then a hop to the next chunk
+    class iterator
+    {
+    private:
+        const ChunkedVector* owner;
+        std::size_t index;
+        T* current;
+        T* chunkEnd;
+
+        void reposition()
+        {
+            if (owner == nullptr || index >= owner->count)
+            {
+                current = chunkEnd = nullptr;
+                return;
+            }
+            T* base = owner->chunks[index >> CHUNK_SHIFT].get();
+            current = base + (index & CHUNK_MASK);
+            std::size_t chunkLast = ((index >> CHUNK_SHIFT) + 1) << CHUNK_SHIFT;
+            std::size_t limit = chunkLast < owner->count ? chunkLast : owner->count;
+            chunkEnd = base + (limit - (index & ~CHUNK_MASK));
+        }
+
+    public:
+        iterator(const ChunkedVector* o, std::size_t i) : owner(o), index(i)
+        {
+            reposition();
+        }
+
+        T& operator*() const { return *current; }
+
+        iterator& operator++()
+        {
+            ++index;
+            ++current;
+            if (current == chunkEnd)
+            {
+                reposition();       // hop to the next chunk (or end)
+            }
+            return *this;
+        }
+
+        bool operator!=(const iterator& other) const { return index != other.index; }
+    };
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, count); }
+};
+
+#endif // CHUNKED_VECTOR_H
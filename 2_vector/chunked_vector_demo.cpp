@@ -0,0 +1,153 @@
+/*
+### ChunkedVector in Action
+
+Demonstrates the stable-pointer growth container from
+chunked_vector.h against the std::vector behavior shown in
+vector_add.cpp:
+
+1. Pointer stability — addresses taken before a million appends are
+   still valid after them (with std::vector this is use-after-free)
+2. Append cost over time — std::vector's doubling shows up as stalls
+   in the growth windows where a reallocation lands; ChunkedVector's
+   windows stay flat
+3. Bulk iteration — for_each_chunk's plain pointer loops vectorize
+   like a flat array, and the segmented range-for iterator walks the
+   same chunks
+
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+
+#include "chunked_vector.h"
+
+using namespace std;
+
+int main()
+{
+    cout << "=== Example 1: Stable Addresses Across Growth ===" << endl;
+    {
+        ChunkedVector<int> stable;
+        stable.push_back(111);
+        for (int i = 1; i < 5000; ++i) stable.push_back(i);
+
+        int* first = &stable[0];
+        int* mid = &stable[4999];
+        cout << "Pointers taken at size " << stable.size() << endl;
+
+        for (int i = 0; i < 1000000; ++i)
+        {
+            stable.push_back(i);
+        }
+
+        cout << "After 1M more appends (" << stable.chunkCount()
+             << " chunks): *first = " << *first
+             << ", *mid = " << *mid << " — both still valid" << endl;
+        cout << "(std::vector would have relocated them several times over)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Append Cost Stays Flat ===" << endl;
+    {
+        const size_t WINDOW = 4000000;
+        const int WINDOWS = 6;
+
+        cout << "Appending " << WINDOWS << " windows of " << WINDOW
+             << " ints, ms per window:" << endl;
+
+        vector<int> doubling;
+        cout << "  std::vector:  ";
+        for (int w = 0; w < WINDOWS; ++w)
+        {
+            auto start = chrono::steady_clock::now();
+            for (size_t i = 0; i < WINDOW; ++i)
+            {
+                doubling.push_back((int)i);
+            }
+            cout << chrono::duration_cast<chrono::milliseconds>(
+                chrono::steady_clock::now() - start).count() << " ";
+        }
+        cout << endl;
+
+        ChunkedVector<int> chunked;
+        cout << "  ChunkedVector: ";
+        for (int w = 0; w < WINDOWS; ++w)
+        {
+            auto start = chrono::steady_clock::now();
+            for (size_t i = 0; i < WINDOW; ++i)
+            {
+                chunked.push_back((int)i);
+            }
+            cout << chrono::duration_cast<chrono::milliseconds>(
+                chrono::steady_clock::now() - start).count() << " ";
+        }
+        cout << endl;
+        cout << "(vector's spikes are the doubling copies; no window of" << endl;
+        cout << " ChunkedVector ever relocates an element)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Segmented Iteration ===" << endl;
+    {
+        const size_t N = 20000000;
+        ChunkedVector<int> data;
+        data.reserve(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            data.push_back((int)(i % 251));
+        }
+
+        // Chunk-wise: the inner loop is a flat pointer walk
+        auto start = chrono::steady_clock::now();
+        long long chunkSum = 0;
+        data.for_each_chunk([&](const int* begin, const int* end) {
+            long long partial = 0;
+            for (const int* p = begin; p != end; ++p)
+            {
+                partial += *p;
+            }
+            chunkSum += partial;
+        });
+        auto chunkMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        // Index-wise: two indirections per element
+        start = chrono::steady_clock::now();
+        long long indexSum = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            indexSum += data[i];
+        }
+        auto indexMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        // Range-for over the segmented iterator
+        start = chrono::steady_clock::now();
+        long long iterSum = 0;
+        for (int value : data)
+        {
+            iterSum += value;
+        }
+        auto iterMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << N << " elements summed:" << endl;
+        cout << "  for_each_chunk (pointer walk): " << chunkMs << " ms" << endl;
+        cout << "  operator[] loop:               " << indexMs << " ms" << endl;
+        cout << "  segmented range-for:           " << iterMs << " ms" << endl;
+        cout << "Sums agree: "
+             << (chunkSum == indexSum && indexSum == iterSum ? "OK" : "MISMATCH")
+             << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Fixed 4096-element chunks: append never relocates anything" << endl;
+    cout << "2. Element addresses are stable for the container's lifetime" << endl;
+    cout << "3. Index = (chunk table >> 12, offset & 0xFFF) — shift and mask" << endl;
+    cout << "4. for_each_chunk: flat (begin, end) runs the compiler vectorizes" << endl;
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+/*
+### Parallel Bulk Operations on Vectors
+
+vector_functions.cpp walks its vectors on one core. This example runs
+the same shapes of work through Engine::ThreadPool using the bulk
+algorithms in 1_namespace/engine_parallel.h:
+
+1. parallel_transform — element-wise map, chunked by a cache-friendly
+   grain so each worker streams a contiguous slice
+2. parallel_reduce — per-chunk local folds, then a TREE combine of the
+   partials (log2 depth instead of a serial chain)
+3. parallel_sort — one sorted run per worker, then parallel pairwise
+   inplace_merge rounds
+4. parallel_first_touch — fault pages in from the worker that will
+   later process them, so on NUMA machines data lands on the right
+   socket (and everywhere else the page faults move off the timed path)
+
+Every parallel result is checked against its serial std:: counterpart.
+Speedups scale with available cores; on a loaded or single-core box
+the two columns converge — the point is the identical answers.
+*/
+
+#include <iostream>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+#include "../1_namespace/engine_thread_pool.h"
+#include "../1_namespace/engine_parallel.h"
+
+using namespace std;
+
+static long long msSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration_cast<chrono::milliseconds>(
+        chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    Engine::ThreadPool pool;
+    cout << "Pool workers: " << pool.workerCount() << endl;
+    cout << endl;
+
+    cout << "=== Example 1: parallel_transform ===" << endl;
+    {
+        const size_t N = 8000000;
+        vector<double> in(N), outSerial(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            in[i] = 0.5 + (double)(i % 1000);
+        }
+
+        // The parallel output buffer is RAW storage, first-touched by
+        // the pool before any other thread writes it — a vector's
+        // constructor would zero (and so fault in) every page from
+        // this thread, making the placement call a no-op
+        double* outParallel = (double*)::operator new(N * sizeof(double));
+        Engine::parallel_first_touch(pool, outParallel, N);
+
+        auto fn = [](double x) { return sqrt(x) * 3.0 + 1.0; };
+
+        auto start = chrono::steady_clock::now();
+        transform(in.begin(), in.end(), outSerial.begin(), fn);
+        auto serialMs = msSince(start);
+
+        start = chrono::steady_clock::now();
+        Engine::parallel_transform(pool, in.data(), outParallel, N, fn);
+        auto parallelMs = msSince(start);
+
+        cout << N << " elements, sqrt(x)*3+1:" << endl;
+        cout << "  std::transform:      " << serialMs << " ms" << endl;
+        cout << "  parallel_transform:  " << parallelMs << " ms" << endl;
+        cout << "  Results match: "
+             << (equal(outSerial.begin(), outSerial.end(), outParallel)
+                 ? "OK" : "MISMATCH") << endl;
+        ::operator delete((void*)outParallel);
+    }
+    cout << endl;
+
+    cout << "=== Example 2: parallel_reduce with Tree Combine ===" << endl;
+    {
+        const size_t N = 16000000;
+        vector<long long> data(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            data[i] = (long long)(i % 251) - 125;
+        }
+
+        auto start = chrono::steady_clock::now();
+        long long serialSum = accumulate(data.begin(), data.end(), 0LL);
+        auto serialMs = msSince(start);
+
+        start = chrono::steady_clock::now();
+        long long parallelSum = Engine::parallel_reduce(
+            pool, data.data(), N, 0LL,
+            [](long long a, long long b) { return a + b; });
+        auto parallelMs = msSince(start);
+
+        cout << N << " elements summed:" << endl;
+        cout << "  std::accumulate:  " << serialMs << " ms -> " << serialSum << endl;
+        cout << "  parallel_reduce:  " << parallelMs << " ms -> " << parallelSum << endl;
+        cout << "  Results match: "
+             << (serialSum == parallelSum ? "OK" : "MISMATCH") << endl;
+
+        // The combine doesn't have to be +: max works with any
+        // associative operation and its identity
+        long long maxValue = Engine::parallel_reduce(
+            pool, data.data(), N, data[0],
+            [](long long a, long long b) { return a > b ? a : b; });
+        cout << "  Same machinery, max instead of +: " << maxValue
+             << " (expect 125)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: parallel_sort ===" << endl;
+    {
+        const size_t N = 8000000;
+        vector<int> serialData(N);
+        mt19937 gen(42);
+        for (size_t i = 0; i < N; ++i)
+        {
+            serialData[i] = (int)gen();
+        }
+        vector<int> parallelData = serialData;
+
+        auto start = chrono::steady_clock::now();
+        sort(serialData.begin(), serialData.end());
+        auto serialMs = msSince(start);
+
+        start = chrono::steady_clock::now();
+        Engine::parallel_sort(pool, parallelData.data(), N);
+        auto parallelMs = msSince(start);
+
+        cout << N << " random ints:" << endl;
+        cout << "  std::sort:      " << serialMs << " ms" << endl;
+        cout << "  parallel_sort:  " << parallelMs << " ms" << endl;
+        cout << "  Sorted:  "
+             << (is_sorted(parallelData.begin(), parallelData.end()) ? "OK" : "NOT SORTED")
+             << endl;
+        cout << "  Same elements: "
+             << (serialData == parallelData ? "OK" : "MISMATCH") << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 4: First-Touch Placement ===" << endl;
+    {
+        const size_t N = 16000000;
+        auto sumAll = [&](const double* p) {
+            return Engine::parallel_reduce(
+                pool, p, N, 0.0, [](double a, double b) { return a + b; });
+        };
+
+        // Serial touch: the main thread faults in every page, so on a
+        // NUMA box ALL pages belong to its node and far workers later
+        // stream them over the interconnect
+        double* serialTouched = (double*)::operator new(N * sizeof(double));
+        for (size_t i = 0; i < N; ++i) serialTouched[i] = 1.0;
+        auto start = chrono::steady_clock::now();
+        double s1 = sumAll(serialTouched);
+        auto serialTouchMs = msSince(start);
+        ::operator delete((void*)serialTouched);
+
+        // Parallel first touch with the SAME grain mapping the
+        // processing pass uses: each page faults in on the worker
+        // that will later read it
+        double* firstTouched = (double*)::operator new(N * sizeof(double));
+        Engine::parallel_first_touch(pool, firstTouched, N);
+        pool.parallel_for(0, N, Engine::DEFAULT_GRAIN, [&](size_t i) {
+            firstTouched[i] = 1.0;
+        });
+        start = chrono::steady_clock::now();
+        double s2 = sumAll(firstTouched);
+        auto firstTouchMs = msSince(start);
+        ::operator delete((void*)firstTouched);
+
+        cout << "Parallel sum after serial touch:    " << serialTouchMs
+             << " ms (sum " << s1 << ")" << endl;
+        cout << "Parallel sum after parallel touch:  " << firstTouchMs
+             << " ms (sum " << s2 << ")" << endl;
+        cout << "On a single socket the two are close; across sockets the" << endl;
+        cout << "serially-touched buffer pays interconnect latency on every" << endl;
+        cout << "cache line the far workers stream." << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Chunk by grain (64K default): overhead amortized, stealing balances" << endl;
+    cout << "2. Reduce combines partials as a tree — log2(chunks) depth" << endl;
+    cout << "3. Sort: per-worker runs, then parallel pairwise inplace_merge rounds" << endl;
+    cout << "4. First-touch with the processing pass's grain mapping places" << endl;
+    cout << "   pages on the socket that will use them" << endl;
+
+    return 0;
+}
@@ -86,10 +86,30 @@ Note: Lexicographical comparison works like dictionary ordering:
 - Compare first elements, if different, return result
 - If same, compare second elements, and so on
 - Shorter vector is less if all elements match
+
+
+### Measured cost
+All of these operators are O(n) element walks. The "Measured" section
+at the end times them with the shared bench.h harness (ns/op,
+cycles/op, plus CSV for regression tracking) so the cost at 1K and
+100K elements is a number, not a guess.
+
+### Measured sort throughput
+The last section benchmarks the fast_sort.h module (LSD radix,
+pattern-defeating introsort, parallel radix on Engine::ThreadPool)
+against std::sort on 64-bit keys and reports MB/s across sizes.
 */
 
 #include <iostream>
 #include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <random>
+
+#include "../bench.h"
+#include "fast_sort.h"
 
 using namespace std;
 
@@ -154,6 +174,137 @@ int main()
     cout << "{1, 2} < {1, 2, 3}: " << (v5 < v1 ? "true" : "false") << endl;
     cout << "{1, 2, 3} < {1, 2, 4}: " << (v1 < v3 ? "true" : "false") << endl;
     cout << "{1, 2, 3} < {1, 3, 2}: " << (v1 < v4 ? "true" : "false") << endl;
+    cout << endl;
+
+    // What the operators above actually cost at scale
+    cout << "=== Measured: Comparison Cost vs Size ===" << endl;
+    {
+        vector<int> small1(1000), small2(1000);
+        for (size_t i = 0; i < small1.size(); ++i)
+        {
+            small1[i] = small2[i] = (int)i;
+        }
+
+        vector<int> big1(100000), big2(100000);
+        for (size_t i = 0; i < big1.size(); ++i)
+        {
+            big1[i] = big2[i] = (int)i;
+        }
+
+        vector<int> firstDiffers = big1;
+        firstDiffers[0] = -1;               // == bails on element 0
+
+        BENCH("vector== 1K equal")
+        {
+            (void)bench_i;
+            bool eq = (small1 == small2);
+            bench::doNotOptimize(eq);
+        };
+
+        BENCH("vector== 100K equal")
+        {
+            (void)bench_i;
+            bool eq = (big1 == big2);
+            bench::doNotOptimize(eq);
+        };
+
+        BENCH("vector== 100K first element differs")
+        {
+            (void)bench_i;
+            bool eq = (big1 == firstDiffers);
+            bench::doNotOptimize(eq);
+        };
+
+        BENCH("vector<  100K equal (full walk)")
+        {
+            (void)bench_i;
+            bool lt = (big1 < big2);
+            bench::doNotOptimize(lt);
+        };
+    }
+
+    cout << endl;
+    cout << "=== Measured: Sort Throughput (fast_sort.h) ===" << endl;
+    {
+        // Harness hooks at one size: each iteration restores the
+        // unsorted input with a memcpy (included in the number) and
+        // sorts it, so ns/op is the cost of one full 16K-key sort
+        const size_t SMALL = 16384;
+        mt19937_64 rng(42);
+        vector<long long> master(SMALL);
+        for (long long& k : master) k = (long long)rng();
+        vector<long long> work(SMALL);
+
+        BENCH("sort 16K std::sort")
+        {
+            (void)bench_i;
+            memcpy(work.data(), master.data(), SMALL * sizeof(long long));
+            sort(work.begin(), work.end());
+            bench::doNotOptimize(work[0]);
+        };
+
+        BENCH("sort 16K introsort (pdq-style)")
+        {
+            (void)bench_i;
+            memcpy(work.data(), master.data(), SMALL * sizeof(long long));
+            FastSort::introsort(work.data(), work.data() + SMALL);
+            bench::doNotOptimize(work[0]);
+        };
+
+        BENCH("sort 16K radix (LSD)")
+        {
+            (void)bench_i;
+            memcpy(work.data(), master.data(), SMALL * sizeof(long long));
+            FastSort::radix_sort(work.data(), SMALL);
+            bench::doNotOptimize(work[0]);
+        };
+
+        bench::reportTable();
+        bench::reportCsv();
+
+        // Throughput across sizes: one timed run each, MB/s of key
+        // data sorted. Radix's O(n) scatter pulls ahead as n grows
+        // and std::sort's log n factor keeps climbing
+        Engine::ThreadPool pool(thread::hardware_concurrency());
+        cout << endl;
+        cout << "Throughput (MB/s of 64-bit keys, random input):" << endl;
+        printf("%10s %12s %12s %12s %14s\n",
+               "keys", "std::sort", "introsort", "radix", "radix-par");
+        for (size_t n : {1u << 20, 1u << 22, 1u << 24})
+        {
+            vector<long long> input(n);
+            for (long long& k : input) k = (long long)rng();
+            double mb = (double)(n * sizeof(long long)) / 1e6;
+
+            auto mbps = [&](auto sortFn) {
+                vector<long long> data = input;
+                auto t0 = chrono::steady_clock::now();
+                sortFn(data);
+                double sec = chrono::duration<double>(
+                    chrono::steady_clock::now() - t0).count();
+                if (!is_sorted(data.begin(), data.end()))
+                {
+                    cout << "SORT FAILED" << endl;
+                }
+                return mb / sec;
+            };
+
+            double stdMbps = mbps([](vector<long long>& d) {
+                sort(d.begin(), d.end()); });
+            double pdqMbps = mbps([](vector<long long>& d) {
+                FastSort::introsort(d.data(), d.data() + d.size()); });
+            double radixMbps = mbps([](vector<long long>& d) {
+                FastSort::radix_sort(d.data(), d.size()); });
+            double parMbps = mbps([&](vector<long long>& d) {
+                FastSort::radix_sort_parallel(pool, d.data(), d.size()); });
+
+            printf("%10zu %12.0f %12.0f %12.0f %14.0f\n",
+                   n, stdMbps, pdqMbps, radixMbps, parMbps);
+        }
+        cout << "(radix-par gains need real cores; single-core runs pay"
+             << endl;
+        cout << " the merge phase on top of the scatter)" << endl;
+    }
 
     return 0;
 }
@@ -88,7 +88,18 @@ example:
 #include <iostream>
 #include <vector>
 
+#define PERF_SCOPE_ENABLED
+#include "../perf_scope.h"
+
 using namespace std;
+
+// PERF_SCOPE exemplar: records an rdtsc delta per call into a
+// thread-local histogram (see perf_scope.h at the repo root)
+static void timedPushBack(vector<int>& v, int value)
+{
+    PERF_SCOPE("vector.push_back");
+    v.push_back(value);
+}
 int main()
 {
     vector<int> numbers; // Create an empty vector of integers
@@ -147,5 +158,22 @@ int main()
     {
         cout << "The vectors are not equal." << endl;
     }
+
+    // Instrumented push_back: most calls are a store and a bump, but
+    // every reallocation copies the whole vector — the histogram's
+    // tail columns make those spikes visible
+    cout << endl;
+    cout << "=== Instrumented: push_back Latency Histogram ===" << endl;
+    vector<int> timed;
+    for (int i = 0; i < 1000000; ++i)
+    {
+        timedPushBack(timed, i);
+    }
+    cout << "1000000 instrumented push_back calls, final size: "
+         << timed.size() << endl;
+    Perf::dump();
+    cout << "The gap between p50 and max is the reallocation cost;" << endl;
+    cout << "reserve() up front would flatten the tail" << endl;
+
     return 0;
 }
\ No newline at end of file
@@ -87,10 +87,20 @@ Note: Lexicographical comparison works like dictionary ordering:
 - Compare first elements, if different, return result
 - If same, compare second elements, and so on
 - All arrays being compared must have the same size
+
+
+### Measured cost
+Because array sizes are compile-time constants, the compiler can turn
+== into a memcmp and unroll small compares entirely. The "Measured"
+section at the end uses the shared bench.h harness to show that at
+16 and 4096 elements.
 */
 
 #include <iostream>
 #include <array>
+#include <cstddef>
+
+#include "../bench.h"
 
 using namespace std;
 
@@ -155,6 +165,57 @@ int main()
     cout << "{0, 5, 5} < {1, 2, 3}: " << (arr5 < arr1 ? "true" : "false") << endl;
     cout << "{1, 2, 3} < {1, 2, 4}: " << (arr1 < arr3 ? "true" : "false") << endl;
     cout << "{1, 2, 3} < {1, 3, 2}: " << (arr1 < arr4 ? "true" : "false") << endl;
+    cout << endl;
+
+    // What the operators above actually cost at scale
+    cout << "=== Measured: Comparison Cost vs Size ===" << endl;
+    {
+        array<int, 16> tiny1{}, tiny2{};
+        for (size_t i = 0; i < tiny1.size(); ++i)
+        {
+            tiny1[i] = tiny2[i] = (int)i;
+        }
+
+        array<int, 4096> big1{}, big2{};
+        for (size_t i = 0; i < big1.size(); ++i)
+        {
+            big1[i] = big2[i] = (int)i;
+        }
+
+        array<int, 4096> firstDiffers = big1;
+        firstDiffers[0] = -1;               // == bails on element 0
+
+        BENCH("array== 16 equal")
+        {
+            (void)bench_i;
+            bool eq = (tiny1 == tiny2);
+            bench::doNotOptimize(eq);
+        };
+
+        BENCH("array== 4096 equal")
+        {
+            (void)bench_i;
+            bool eq = (big1 == big2);
+            bench::doNotOptimize(eq);
+        };
+
+        BENCH("array== 4096 first element differs")
+        {
+            (void)bench_i;
+            bool eq = (big1 == firstDiffers);
+            bench::doNotOptimize(eq);
+        };
+
+        BENCH("array<  4096 equal (full walk)")
+        {
+            (void)bench_i;
+            bool lt = (big1 < big2);
+            bench::doNotOptimize(lt);
+        };
+
+        bench::reportTable();
+        bench::reportCsv();
+    }
 
     return 0;
 }
@@ -0,0 +1,161 @@
+/*
+### CtArray — Compile-Time Array Algorithms
+
+array_functions.cpp and array_operations.cpp compute sums, minima and
+maxima over std::array at RUNTIME, even though every size involved is
+a compile-time constant. When the inputs are constants too, the whole
+computation can run inside the compiler and ship as finished data:
+
+1. sum / dot / min_value / max_value / prefix_sum / sorted — fully
+   constexpr over std::array<T, N>; call them with constexpr inputs
+   and the result is a compile-time constant you can static_assert
+2. For N <= 32 the reductions expand through a fold over an index
+   sequence — one expression per element, no loop counter, which is
+   the C++17 spelling of an unrolled kernel (a hand-specialized
+   template per N would say the same thing 32 times over)
+3. makeTable<N>(fn) bakes a lookup table by evaluating fn(0..N-1) at
+   compile time — the classic firmware move: the table costs flash
+   bytes, not boot cycles
+
+Everything also works at runtime on non-constant inputs; constexpr is
+a superset, not a fork.
+*/
+
+#ifndef CONSTEXPR_ARRAY_H
+#define CONSTEXPR_ARRAY_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace CtArray
+{
+    constexpr std::size_t UNROLL_LIMIT = 32;
+
+    namespace detail
+    {
+        // Fold over an index sequence: the compiler sees one addition
+        // per element, fully unrolled, no induction variable
+        template<typename T, std::size_t N, std::size_t... I>
+        constexpr T sumUnrolled(const std::array<T, N>& a, std::index_sequence<I...>)
+        {
+            return (T{} + ... + a[I]);
+        }
+
+        template<typename T, std::size_t N, std::size_t... I>
+        constexpr T dotUnrolled(const std::array<T, N>& a, const std::array<T, N>& b,
+                                std::index_sequence<I...>)
+        {
+            return (T{} + ... + (a[I] * b[I]));
+        }
+    }
+
+    template<typename T, std::size_t N>
+    constexpr T sum(const std::array<T, N>& a)
+    {
+        if constexpr (N <= UNROLL_LIMIT)
+        {
+            return detail::sumUnrolled(a, std::make_index_sequence<N>{});
+        }
+        else
+        {
+            T total{};
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                total += a[i];
+            }
+            return total;
+        }
+    }
+
+    template<typename T, std::size_t N>
+    constexpr T dot(const std::array<T, N>& a, const std::array<T, N>& b)
+    {
+        if constexpr (N <= UNROLL_LIMIT)
+        {
+            return detail::dotUnrolled(a, b, std::make_index_sequence<N>{});
+        }
+        else
+        {
+            T total{};
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                total += a[i] * b[i];
+            }
+            return total;
+        }
+    }
+
+    template<typename T, std::size_t N>
+    constexpr T min_value(const std::array<T, N>& a)
+    {
+        static_assert(N > 0, "min_value of an empty array");
+        T best = a[0];
+        for (std::size_t i = 1; i < N; ++i)
+        {
+            if (a[i] < best) best = a[i];
+        }
+        return best;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr T max_value(const std::array<T, N>& a)
+    {
+        static_assert(N > 0, "max_value of an empty array");
+        T best = a[0];
+        for (std::size_t i = 1; i < N; ++i)
+        {
+            if (best < a[i]) best = a[i];
+        }
+        return best;
+    }
+
+    // Inclusive prefix scan: out[i] = a[0] + ... + a[i]
+    template<typename T, std::size_t N>
+    constexpr std::array<T, N> prefix_sum(const std::array<T, N>& a)
+    {
+        std::array<T, N> out{};
+        T running{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            running += a[i];
+            out[i] = running;
+        }
+        return out;
+    }
+
+    // Insertion sort: quadratic, but N is a compile-time constant and
+    // the work happens inside the compiler — run time is zero
+    template<typename T, std::size_t N>
+    constexpr std::array<T, N> sorted(std::array<T, N> a)
+    {
+        for (std::size_t i = 1; i < N; ++i)
+        {
+            T key = a[i];
+            std::size_t j = i;
+            while (j > 0 && key < a[j - 1])
+            {
+                a[j] = a[j - 1];
+                --j;
+            }
+            a[j] = key;
+        }
+        return a;
+    }
+
+    // Bake a table: fn(i) evaluated for i in [0, N) at compile time.
+    // Declare the result constexpr and it ships as initialized data.
+    template<std::size_t N, typename Fn>
+    constexpr auto makeTable(Fn fn)
+    {
+        std::array<decltype(fn(std::size_t{0})), N> table{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            table[i] = fn(i);
+        }
+        return table;
+    }
+
+} // namespace CtArray
+
+#endif // CONSTEXPR_ARRAY_H
@@ -0,0 +1,114 @@
+/*
+### Compile-Time Array Math in Action
+
+Exercises constexpr_array.h. Everything in the static_assert block is
+evaluated by the COMPILER — if this file builds, those results were
+computed before the program ever ran, and the runtime sections below
+are just printing constants that live in the binary's data segment.
+
+1. static_assert-ed reductions: sum, dot, min/max, prefix_sum, sorted
+2. A baked lookup table (integer square roots) — the firmware pattern:
+   flash bytes instead of boot cycles
+3. The same calls on runtime data, to show constexpr functions are
+   ordinary functions when the inputs aren't constants
+*/
+
+#include <iostream>
+#include <array>
+#include <cstddef>
+
+#include "constexpr_array.h"
+
+using namespace std;
+
+// Integer sqrt by binary search — constexpr-friendly, no <cmath>
+constexpr unsigned isqrt(size_t x)
+{
+    unsigned lo = 0, hi = 65535;
+    while (lo < hi)
+    {
+        unsigned mid = (lo + hi + 1) / 2;
+        if ((size_t)mid * mid <= x) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo;
+}
+
+// ---- All of this runs at compile time ----
+constexpr array<int, 8> SMALL = {5, 3, 8, 1, 9, 2, 7, 4};
+constexpr array<int, 8> WEIGHTS = {1, 2, 3, 4, 5, 6, 7, 8};
+
+static_assert(CtArray::sum(SMALL) == 39, "sum baked at compile time");
+static_assert(CtArray::dot(SMALL, WEIGHTS) == 5 + 6 + 24 + 4 + 45 + 12 + 49 + 32,
+              "dot baked at compile time");
+static_assert(CtArray::min_value(SMALL) == 1, "min baked at compile time");
+static_assert(CtArray::max_value(SMALL) == 9, "max baked at compile time");
+
+constexpr auto PREFIX = CtArray::prefix_sum(SMALL);
+static_assert(PREFIX[0] == 5 && PREFIX[7] == 39, "scan baked at compile time");
+
+constexpr auto SORTED = CtArray::sorted(SMALL);
+static_assert(SORTED[0] == 1 && SORTED[7] == 9, "sort ran inside the compiler");
+
+// The baked table: 256 integer square roots, finished data in flash
+constexpr auto SQRT_TABLE = CtArray::makeTable<256>([](size_t i) {
+    return isqrt(i * 1024);
+});
+static_assert(SQRT_TABLE[0] == 0, "sqrt(0)");
+static_assert(SQRT_TABLE[4] == 64, "sqrt(4096) = 64");
+static_assert(SQRT_TABLE[255] == 510, "sqrt(261120) = 510");
+
+// Past the unroll limit the loop form kicks in — still constexpr
+constexpr auto BIG_TABLE = CtArray::makeTable<100>([](size_t i) {
+    return (int)(i * i);
+});
+static_assert(CtArray::sum(BIG_TABLE) == 328350, "loop form is constexpr too");
+
+int main()
+{
+    cout << "=== Example 1: Results Computed at Build Time ===" << endl;
+    cout << "sum(SMALL) = " << CtArray::sum(SMALL)
+         << " (static_assert-ed: the compiler checked it)" << endl;
+    cout << "dot(SMALL, WEIGHTS) = " << CtArray::dot(SMALL, WEIGHTS) << endl;
+    cout << "min/max = " << CtArray::min_value(SMALL)
+         << "/" << CtArray::max_value(SMALL) << endl;
+
+    cout << "prefix_sum: ";
+    for (int v : PREFIX) cout << v << " ";
+    cout << endl;
+
+    cout << "sorted:     ";
+    for (int v : SORTED) cout << v << " ";
+    cout << endl;
+    cout << endl;
+
+    cout << "=== Example 2: Baked Lookup Table ===" << endl;
+    cout << "SQRT_TABLE[i] ~= sqrt(i * 1024), 256 entries of data segment:" << endl;
+    for (size_t i : {0, 1, 16, 64, 255})
+    {
+        cout << "  SQRT_TABLE[" << i << "] = " << SQRT_TABLE[i] << endl;
+    }
+    cout << "No isqrt() call survives to runtime — lookups are one load." << endl;
+    cout << endl;
+
+    cout << "=== Example 3: Same Functions on Runtime Data ===" << endl;
+    array<int, 8> runtime;
+    for (size_t i = 0; i < runtime.size(); ++i)
+    {
+        runtime[i] = (int)(i * 3 + 1);
+    }
+    cout << "sum = " << CtArray::sum(runtime)
+         << ", max = " << CtArray::max_value(runtime) << endl;
+    cout << "(constexpr functions are ordinary functions on ordinary data;" << endl;
+    cout << " with N <= " << CtArray::UNROLL_LIMIT
+         << " the reduction is an unrolled fold either way)" << endl;
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. constexpr sum/dot/min/max/prefix_sum/sorted over std::array" << endl;
+    cout << "2. N <= 32: index-sequence fold — unrolled, no loop counter" << endl;
+    cout << "3. makeTable<N>(fn) bakes lookup tables into the data segment" << endl;
+    cout << "4. static_assert turns expected results into build-time checks" << endl;
+
+    return 0;
+}
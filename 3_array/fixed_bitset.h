@@ -0,0 +1,192 @@
+/*
+### FixedBitSet<N> — Word-Parallel Small Integer Sets
+
+array.cpp checks membership by scanning an array element by element —
+fine for a demo, but an ID-set checked millions of times per second
+deserves one bit per possible ID instead of one comparison per stored
+element:
+
+1. Storage is N bits packed into 64-bit words, sized at compile time:
+   a 4096-ID universe is 64 words (512 bytes — smaller than the
+   array it replaces, and cache-resident)
+2. test/set/reset are one shift and one mask; no search of any kind
+3. Set algebra runs 64 members per instruction: &= is intersection,
+   |= is union, count() is a hardware-popcount loop, and
+   intersect_into(a, b) combines both — one pass, no temporary
+4. Sparse iteration skips empty space: first_set()/next_set() use
+   count-trailing-zeros to jump straight to the next set bit, and
+   for_each_set() wraps that in a callback loop, so a 4096-bit set
+   with 12 members costs ~64 word tests + 12 tzcnt hops, not 4096
+   bit probes
+
+fixed_bitset_demo.cpp measures the payoff: membership and
+intersection over a 4K universe against the linear-scan idiom.
+*/
+
+#ifndef FIXED_BITSET_H
+#define FIXED_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+
+template<std::size_t N>
+class FixedBitSet
+{
+public:
+    static constexpr std::size_t BIT_COUNT = N;
+    static constexpr std::size_t WORD_BITS = 64;
+    static constexpr std::size_t WORD_COUNT = (N + WORD_BITS - 1) / WORD_BITS;
+
+    // npos terminates first_set()/next_set() iteration
+    static constexpr std::size_t npos = (std::size_t)-1;
+
+private:
+    std::uint64_t words[WORD_COUNT] = {};
+
+    static std::size_t popcount(std::uint64_t w)
+    {
+#if defined(__GNUC__)
+        return (std::size_t)__builtin_popcountll(w);
+#else
+        std::size_t c = 0;
+        while (w) { w &= w - 1; ++c; }
+        return c;
+#endif
+    }
+
+    static std::size_t trailingZeros(std::uint64_t w)
+    {
+#if defined(__GNUC__)
+        return (std::size_t)__builtin_ctzll(w);
+#else
+        std::size_t c = 0;
+        while (!(w & 1)) { w >>= 1; ++c; }
+        return c;
+#endif
+    }
+
+public:
+    // ### Single-bit operations: shift, mask, done
+    void set(std::size_t bit)
+    {
+        words[bit / WORD_BITS] |= (std::uint64_t)1 << (bit % WORD_BITS);
+    }
+
+    void reset(std::size_t bit)
+    {
+        words[bit / WORD_BITS] &= ~((std::uint64_t)1 << (bit % WORD_BITS));
+    }
+
+    bool test(std::size_t bit) const
+    {
+        return (words[bit / WORD_BITS] >> (bit % WORD_BITS)) & 1;
+    }
+
+    void clear()
+    {
+        for (std::size_t w = 0; w < WORD_COUNT; ++w)
+        {
+            words[w] = 0;
+        }
+    }
+
+    // ### Whole-set algebra: 64 members per instruction
+    FixedBitSet& operator&=(const FixedBitSet& other)
+    {
+        for (std::size_t w = 0; w < WORD_COUNT; ++w)
+        {
+            words[w] &= other.words[w];
+        }
+        return *this;
+    }
+
+    FixedBitSet& operator|=(const FixedBitSet& other)
+    {
+        for (std::size_t w = 0; w < WORD_COUNT; ++w)
+        {
+            words[w] |= other.words[w];
+        }
+        return *this;
+    }
+
+    std::size_t count() const
+    {
+        std::size_t total = 0;
+        for (std::size_t w = 0; w < WORD_COUNT; ++w)
+        {
+            total += popcount(words[w]);
+        }
+        return total;
+    }
+
+    // this = a & b and returns the member count, in one pass — the
+    // ACL-check shape (how many permitted IDs are in this request?)
+    // without writing a temporary and re-reading it
+    std::size_t intersect_into(const FixedBitSet& a, const FixedBitSet& b)
+    {
+        std::size_t total = 0;
+        for (std::size_t w = 0; w < WORD_COUNT; ++w)
+        {
+            words[w] = a.words[w] & b.words[w];
+            total += popcount(words[w]);
+        }
+        return total;
+    }
+
+    // Intersection count alone, no result set materialized
+    static std::size_t intersect_count(const FixedBitSet& a, const FixedBitSet& b)
+    {
+        std::size_t total = 0;
+        for (std::size_t w = 0; w < WORD_COUNT; ++w)
+        {
+            total += popcount(a.words[w] & b.words[w]);
+        }
+        return total;
+    }
+
+    // ### Sparse iteration: tzcnt hops from set bit to set bit
+    std::size_t first_set() const
+    {
+        return next_set_from(0);
+    }
+
+    std::size_t next_set(std::size_t bit) const
+    {
+        return next_set_from(bit + 1);
+    }
+
+    template<typename Fn>
+    void for_each_set(Fn fn) const
+    {
+        for (std::size_t w = 0; w < WORD_COUNT; ++w)
+        {
+            std::uint64_t remaining = words[w];
+            while (remaining)
+            {
+                fn(w * WORD_BITS + trailingZeros(remaining));
+                remaining &= remaining - 1;     // clear lowest set bit
+            }
+        }
+    }
+
+private:
+    std::size_t next_set_from(std::size_t bit) const
+    {
+        if (bit >= N) return npos;
+
+        std::size_t w = bit / WORD_BITS;
+        // mask off bits below the start position in the first word
+        std::uint64_t current = words[w] & (~(std::uint64_t)0 << (bit % WORD_BITS));
+        while (true)
+        {
+            if (current)
+            {
+                return w * WORD_BITS + trailingZeros(current);
+            }
+            if (++w >= WORD_COUNT) return npos;
+            current = words[w];
+        }
+    }
+};
+
+#endif // FIXED_BITSET_H
@@ -0,0 +1,358 @@
+/*
+### Copy-on-Write Snapshot Map
+
+The account/inventory maps in map.cpp mirror live service state. A
+consistent read of that state (report, backup, audit) must not see
+half of a transfer — and copying the whole map to get consistency
+stops every writer for as long as the copy takes.
+
+This file adds a versioned COW map where snapshots are free:
+1. The tree's nodes are IMMUTABLE and children are shared_ptrs, so
+   any node can be shared by any number of tree versions
+2. snapshot() copies one shared_ptr and a counter — O(1), no lock
+   held while anyone reads
+3. Writes PATH-COPY: inserting rebuilds only the ~log n nodes on the
+   root-to-key path; everything off the path is shared with all
+   existing snapshots
+4. Garbage collection is the shared_ptr refcount: when the last
+   snapshot referencing an old version dies, exactly the nodes unique
+   to that version are freed
+5. Balance comes from treap priorities (each node gets a random
+   priority; rotations keep the heap property), so paths stay
+   O(log n) without red-black complexity
+
+Writers still serialize against each other (one mutex around the root
+swap), but readers never block writers and writers never block
+readers — a snapshot taken mid-write sees the version before or
+after, never a torn state.
+
+*/
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <chrono>
+#include <cstdint>
+
+using namespace std;
+
+// === The map ===
+
+template<typename Key, typename Value>
+class CowSnapshotMap
+{
+private:
+    struct Node
+    {
+        Key key;
+        Value value;
+        uint32_t priority;
+        shared_ptr<const Node> left;
+        shared_ptr<const Node> right;
+
+        Node(const Key& k, const Value& v, uint32_t p,
+             shared_ptr<const Node> l, shared_ptr<const Node> r)
+            : key(k), value(v), priority(p), left(std::move(l)), right(std::move(r))
+        {
+            liveNodes.fetch_add(1, memory_order_relaxed);
+        }
+
+        ~Node() { liveNodes.fetch_sub(1, memory_order_relaxed); }
+    };
+
+    using NodePtr = shared_ptr<const Node>;
+
+    NodePtr root;
+    size_t entryCount = 0;
+    uint64_t currentVersion = 0;
+    mutable mutex writerGuard;
+    mt19937 rng{12345};
+
+    static NodePtr makeNode(const Key& k, const Value& v, uint32_t priority,
+                            NodePtr left, NodePtr right)
+    {
+        return make_shared<const Node>(k, v, priority, std::move(left), std::move(right));
+    }
+
+    // Path-copying insert: every node on the way down is rebuilt,
+    // everything else is shared. Treap rotations keep balance.
+    NodePtr insertNode(const NodePtr& node, const Key& k, const Value& v,
+                       uint32_t priority, bool& added)
+    {
+        if (!node)
+        {
+            added = true;
+            return makeNode(k, v, priority, nullptr, nullptr);
+        }
+
+        if (k < node->key)
+        {
+            NodePtr newLeft = insertNode(node->left, k, v, priority, added);
+            if (newLeft->priority > node->priority)
+            {
+                // Rotate right: the new left child becomes the parent
+                return makeNode(newLeft->key, newLeft->value, newLeft->priority,
+                                newLeft->left,
+                                makeNode(node->key, node->value, node->priority,
+                                         newLeft->right, node->right));
+            }
+            return makeNode(node->key, node->value, node->priority,
+                            std::move(newLeft), node->right);
+        }
+        if (node->key < k)
+        {
+            NodePtr newRight = insertNode(node->right, k, v, priority, added);
+            if (newRight->priority > node->priority)
+            {
+                // Rotate left
+                return makeNode(newRight->key, newRight->value, newRight->priority,
+                                makeNode(node->key, node->value, node->priority,
+                                         node->left, newRight->left),
+                                newRight->right);
+            }
+            return makeNode(node->key, node->value, node->priority,
+                            node->left, std::move(newRight));
+        }
+
+        // Same key: replace the value, keep both subtrees shared
+        added = false;
+        return makeNode(k, v, node->priority, node->left, node->right);
+    }
+
+    // Merge two subtrees where every key in `low` < every key in
+    // `high` — the erase workhorse
+    static NodePtr mergeNodes(const NodePtr& low, const NodePtr& high)
+    {
+        if (!low) return high;
+        if (!high) return low;
+        if (low->priority > high->priority)
+        {
+            return makeNode(low->key, low->value, low->priority,
+                            low->left, mergeNodes(low->right, high));
+        }
+        return makeNode(high->key, high->value, high->priority,
+                        mergeNodes(low, high->left), high->right);
+    }
+
+    NodePtr eraseNode(const NodePtr& node, const Key& k, bool& removed)
+    {
+        if (!node) return nullptr;
+        if (k < node->key)
+        {
+            return makeNode(node->key, node->value, node->priority,
+                            eraseNode(node->left, k, removed), node->right);
+        }
+        if (node->key < k)
+        {
+            return makeNode(node->key, node->value, node->priority,
+                            node->left, eraseNode(node->right, k, removed));
+        }
+        removed = true;
+        return mergeNodes(node->left, node->right);
+    }
+
+    template<typename Fn>
+    static void inOrder(const NodePtr& node, Fn& fn)
+    {
+        if (!node) return;
+        inOrder(node->left, fn);
+        fn(node->key, node->value);
+        inOrder(node->right, fn);
+    }
+
+public:
+    static atomic<long long> liveNodes;     // for the demos below
+
+    // An immutable view of one version. Holding it pins exactly the
+    // nodes of that version; dropping it releases them.
+    class Snapshot
+    {
+    private:
+        NodePtr root;
+        size_t entryCount;
+        uint64_t snapVersion;
+
+        friend class CowSnapshotMap;
+        Snapshot(NodePtr r, size_t n, uint64_t v)
+            : root(std::move(r)), entryCount(n), snapVersion(v) {}
+
+    public:
+        const Value* find(const Key& k) const
+        {
+            const Node* node = root.get();
+            while (node != nullptr)
+            {
+                if (k < node->key) node = node->left.get();
+                else if (node->key < k) node = node->right.get();
+                else return &node->value;
+            }
+            return nullptr;
+        }
+
+        template<typename Fn>
+        void for_each(Fn fn) const
+        {
+            inOrder(root, fn);
+        }
+
+        size_t size() const { return entryCount; }
+        uint64_t version() const { return snapVersion; }
+    };
+
+    void insert(const Key& k, const Value& v)
+    {
+        lock_guard<mutex> lock(writerGuard);
+        bool added = false;
+        root = insertNode(root, k, v, rng(), added);
+        if (added) entryCount++;
+        currentVersion++;
+    }
+
+    void erase(const Key& k)
+    {
+        lock_guard<mutex> lock(writerGuard);
+        bool removed = false;
+        root = eraseNode(root, k, removed);
+        if (removed) entryCount--;
+        currentVersion++;
+    }
+
+    // Reads go through snapshot(): take one, then find/for_each on it.
+    // (Returning a bare pointer from here would dangle the moment a
+    // writer replaced the version it pointed into.)
+
+    // The whole point: O(1), shares every node with the live tree
+    Snapshot snapshot() const
+    {
+        lock_guard<mutex> lock(writerGuard);
+        return Snapshot(root, entryCount, currentVersion);
+    }
+
+    size_t size() const
+    {
+        lock_guard<mutex> lock(writerGuard);
+        return entryCount;
+    }
+};
+
+template<typename Key, typename Value>
+atomic<long long> CowSnapshotMap<Key, Value>::liveNodes{0};
+
+int main()
+{
+    cout << "=== Example 1: Snapshots Don't See Later Writes ===" << endl;
+    {
+        CowSnapshotMap<string, int> accounts;
+        accounts.insert("Alice", 2500);
+        accounts.insert("Bob", 1800);
+        accounts.insert("Charlie", 3200);
+
+        auto report = accounts.snapshot();
+        cout << "Snapshot taken at version " << report.version()
+             << " with " << report.size() << " accounts" << endl;
+
+        // A transfer happens while the report runs
+        accounts.insert("Alice", 2000);
+        accounts.insert("Bob", 2300);
+
+        cout << "Live Alice: " << *accounts.snapshot().find("Alice")
+             << ", snapshot Alice: " << *report.find("Alice") << endl;
+        cout << "Snapshot totals are consistent: ";
+        int total = 0;
+        report.for_each([&](const string&, const int& balance) { total += balance; });
+        cout << total << " (no torn transfer visible)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Path Copying Shares Structure ===" << endl;
+    {
+        CowSnapshotMap<int, int> state;
+        const int N = 100000;
+        for (int i = 0; i < N; ++i)
+        {
+            state.insert(i, i * 2);
+        }
+
+        auto snap = state.snapshot();
+        long long before = CowSnapshotMap<int, int>::liveNodes.load();
+
+        state.insert(N / 2, -1);        // one write after the snapshot
+
+        long long after = CowSnapshotMap<int, int>::liveNodes.load();
+        cout << N << "-entry map, one insert after snapshot:" << endl;
+        cout << "  nodes before: " << before << endl;
+        cout << "  nodes after:  " << after << " (+" << (after - before)
+             << " — just the root-to-key path, not " << N << ")" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Snapshot Cost vs Full Copy ===" << endl;
+    {
+        const int N = 1000000;
+
+        map<int, int> plain;
+        CowSnapshotMap<int, int> cow;
+        for (int i = 0; i < N; ++i)
+        {
+            plain[i] = i;
+            cow.insert(i, i);
+        }
+
+        auto start = chrono::steady_clock::now();
+        map<int, int> fullCopy = plain;
+        auto copyMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        auto snap = cow.snapshot();
+        auto snapNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << N << " entries:" << endl;
+        cout << "  std::map full copy: " << copyMs << " ms (writers stopped throughout)" << endl;
+        cout << "  COW snapshot():     " << snapNs << " ns" << endl;
+        cout << "Spot check: snapshot find(424242) = "
+             << *snap.find(424242) << ", copy = " << fullCopy[424242] << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 4: Old Versions Are Garbage Collected ===" << endl;
+    {
+        CowSnapshotMap<int, string> config;
+        for (int i = 0; i < 10000; ++i)
+        {
+            config.insert(i, "setting");
+        }
+
+        long long baseline = CowSnapshotMap<int, string>::liveNodes.load();
+        {
+            auto pinned = config.snapshot();
+            for (int i = 0; i < 1000; ++i)
+            {
+                config.insert(i, "changed");    // each write copies a path
+            }
+            cout << "1000 writes with a snapshot pinned: "
+                 << CowSnapshotMap<int, string>::liveNodes.load() - baseline
+                 << " extra nodes retained" << endl;
+        }   // snapshot released here
+
+        cout << "After the snapshot is released: "
+             << CowSnapshotMap<int, string>::liveNodes.load() - baseline
+             << " extra nodes (old paths freed by refcount)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Immutable nodes + shared_ptr children: versions share freely" << endl;
+    cout << "2. snapshot(): copy one shared_ptr — O(1), sub-microsecond" << endl;
+    cout << "3. Writes path-copy ~log n nodes; the rest stays shared" << endl;
+    cout << "4. Refcounts ARE the GC: dropping the last snapshot frees its nodes" << endl;
+    cout << "5. Treap priorities keep paths short without rebalancing machinery" << endl;
+
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*
+### fast_hash_map Demonstration
+
+Exercises the open-addressing hash table from fast_hash_map.h and
+backs the map_comparison discussion with numbers:
+1. Basic operations with the familiar map call patterns
+2. Probe throughput vs std::unordered_map
+3. Tail latency: worst single insert with incremental rehash vs the
+   stop-the-world rehash of std::unordered_map
+4. reserve() as a no-rehash guarantee for latency-critical phases
+5. lookup_batch(): hash/prefetch/resolve in 16-key windows so probe
+   cache misses overlap
+
+*/
+
+#include <iostream>
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+
+#include "fast_hash_map.h"
+
+using namespace std;
+
+int main()
+{
+    cout << "=== Example 1: Basic Operations ===" << endl;
+    {
+        fast_hash_map<string, int> ages;
+
+        ages["Alice"] = 25;
+        ages["Bob"] = 30;
+        ages["Charlie"] = 35;
+
+        if (int* age = ages.find("Bob"))
+        {
+            cout << "Found: Bob is " << *age << endl;
+        }
+
+        cout << "contains(\"Dave\"): " << (ages.contains("Dave") ? "yes" : "no") << endl;
+
+        ages.erase("Bob");
+        cout << "After erase(\"Bob\"), size: " << ages.size() << endl;
+
+        cout << "Entries:" << endl;
+        ages.for_each([](const string& name, int age) {
+            cout << "  " << name << ": " << age << endl;
+        });
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Probe Throughput vs unordered_map ===" << endl;
+    {
+        const int N = 1000000;
+        const int PROBES = 1000000;
+
+        unordered_map<int, int> stdMap;
+        fast_hash_map<int, int> fastMap;
+        stdMap.reserve(N);
+        fastMap.reserve(N);
+
+        for (int i = 0; i < N; ++i)
+        {
+            stdMap[i * 3] = i;
+            fastMap[i * 3] = i;
+        }
+
+        mt19937 rng(42);
+        vector<int> probeKeys(PROBES);
+        for (int& k : probeKeys) k = (int)(rng() % (N * 3));
+
+        long long stdHits = 0;
+        auto start = chrono::steady_clock::now();
+        for (int k : probeKeys)
+        {
+            stdHits += stdMap.count(k);
+        }
+        auto stdNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        long long fastHits = 0;
+        start = chrono::steady_clock::now();
+        for (int k : probeKeys)
+        {
+            fastHits += fastMap.count(k);
+        }
+        auto fastNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << N << " keys, " << PROBES << " random probes:" << endl;
+        cout << "  unordered_map: " << stdNs / PROBES << " ns/probe ("
+             << stdHits << " hits)" << endl;
+        cout << "  fast_hash_map: " << fastNs / PROBES << " ns/probe ("
+             << fastHits << " hits)" << endl;
+        cout << "Hit counts match: " << (stdHits == fastHits ? "OK" : "MISMATCH") << endl;
+        cout << "One SSE2 compare screens 16 slots before any key is touched" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Insert Tail Latency (Incremental Rehash) ===" << endl;
+    {
+        const int N = 1000000;
+
+        // No reserve on either side: both tables must grow as we insert.
+        // unordered_map rehashes everything at once when it grows;
+        // fast_hash_map migrates 32 old slots per insert instead.
+        unordered_map<int, int> stdMap;
+        long long stdWorst = 0;
+        for (int i = 0; i < N; ++i)
+        {
+            auto t0 = chrono::steady_clock::now();
+            stdMap[i] = i;
+            auto ns = chrono::duration_cast<chrono::nanoseconds>(
+                chrono::steady_clock::now() - t0).count();
+            if (ns > stdWorst) stdWorst = ns;
+        }
+
+        fast_hash_map<int, int> fastMap;
+        long long fastWorst = 0;
+        for (int i = 0; i < N; ++i)
+        {
+            auto t0 = chrono::steady_clock::now();
+            fastMap[i] = i;
+            auto ns = chrono::duration_cast<chrono::nanoseconds>(
+                chrono::steady_clock::now() - t0).count();
+            if (ns > fastWorst) fastWorst = ns;
+        }
+
+        cout << N << " inserts, growing from empty:" << endl;
+        cout << "  unordered_map worst insert: " << stdWorst / 1000 << " us" << endl;
+        cout << "  fast_hash_map worst insert: " << fastWorst / 1000 << " us" << endl;
+        cout << "The p99/p999 spike is the all-at-once rehash" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 4: reserve() No-Rehash Guarantee ===" << endl;
+    {
+        fast_hash_map<int, int> pinned;
+        pinned.reserve(100000);
+        cout << "Reserved for 100000 entries, capacity: "
+             << pinned.capacity() << endl;
+
+        for (int i = 0; i < 100000; ++i)
+        {
+            pinned[i] = i;
+        }
+        cout << "After 100000 inserts, capacity: " << pinned.capacity()
+             << " (unchanged)" << endl;
+        cout << "Rehash in progress: "
+             << (pinned.rehash_in_progress() ? "yes" : "no") << endl;
+        cout << "Reserve up front and a latency-critical phase never rehashes" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 5: Batched Lookup with Software Prefetch ===" << endl;
+    {
+        const int N = 8000000;            // big enough that probes miss cache and TLB
+        const int PROBES = 1000000;
+
+        fast_hash_map<int, int> bigMap;
+        bigMap.reserve(N);
+        for (int i = 0; i < N; ++i)
+        {
+            bigMap[i * 3] = i;
+        }
+
+        mt19937 rng(7);
+        vector<int> probeKeys(PROBES);
+        for (int& k : probeKeys) k = (int)(rng() % (N * 3));
+
+        long long singleHits = 0;
+        auto start = chrono::steady_clock::now();
+        for (int k : probeKeys)
+        {
+            singleHits += bigMap.find(k) != nullptr ? 1 : 0;
+        }
+        auto singleNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        vector<int*> results(PROBES);
+        start = chrono::steady_clock::now();
+        bigMap.lookup_batch(probeKeys.data(), probeKeys.size(), results.data());
+        auto batchNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        long long batchHits = 0;
+        for (int* r : results) batchHits += (r != nullptr) ? 1 : 0;
+
+        cout << N << " keys, " << PROBES << " random probes:" << endl;
+        cout << "  find() per event: " << singleNs / PROBES << " ns/probe ("
+             << singleHits << " hits)" << endl;
+        cout << "  lookup_batch:     " << batchNs / PROBES << " ns/probe ("
+             << batchHits << " hits)" << endl;
+        cout << "Hit counts match: "
+             << (singleHits == batchHits ? "OK" : "MISMATCH") << endl;
+        cout << "Hash 16, prefetch 16, resolve 16: misses overlap instead" << endl;
+        cout << "of each probe stalling on its own dependent load" << endl;
+        cout << "(gain is moderate here — open addressing is one miss per" << endl;
+        cout << " probe and the CPU already overlaps independent loop" << endl;
+        cout << " iterations; flat_map's dependent binary search gains more)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Control bytes: probe metadata is 1/16th the cache traffic" << endl;
+    cout << "2. Power-of-two capacity: index = hash & mask" << endl;
+    cout << "3. Incremental rehash: growth cost spread over many inserts" << endl;
+    cout << "4. reserve() pins capacity for predictable latency" << endl;
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+/*
+### flat_map Demonstration
+
+Shows flat_map (flat_map.h) as a drop-in for the std::map patterns in
+map_functions.cpp and map_operations.cpp:
+1. The same find()/count()/lower_bound() call sites work unchanged
+2. insert_sorted() bulk-loads presorted data in O(n)
+3. Probe latency comparison against std::map — contiguous binary
+   search vs red-black tree pointer chasing
+4. lookup_batch(): 16 binary searches advanced in lockstep with
+   software prefetch, so their cache misses overlap
+
+*/
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+
+#include "flat_map.h"
+
+using namespace std;
+
+int main()
+{
+    cout << "=== Example 1: Drop-In for the std::map Call Sites ===" << endl;
+    {
+        flat_map<string, int> ages;
+
+        ages["Alice"] = 25;
+        ages["Bob"] = 30;
+        ages["Charlie"] = 35;
+
+        // Same find() pattern as map_functions.cpp
+        auto it = ages.find("Bob");
+        if (it != ages.end())
+        {
+            cout << "Found: " << it->first << " is " << it->second << endl;
+        }
+
+        cout << "count(\"Alice\"): " << ages.count("Alice") << endl;
+        cout << "count(\"Dave\"): " << ages.count("Dave") << endl;
+        cout << "contains(\"Charlie\"): " << (ages.contains("Charlie") ? "yes" : "no") << endl;
+
+        ages.erase("Bob");
+        cout << "After erase(\"Bob\"), size: " << ages.size() << endl;
+
+        cout << "Iteration (sorted by key):" << endl;
+        for (auto entry : ages)
+        {
+            cout << "  " << entry.first << ": " << entry.second << endl;
+        }
+    }
+    cout << endl;
+
+    cout << "=== Example 2: lower_bound / upper_bound ===" << endl;
+    {
+        flat_map<int, string> grades;
+        grades[60] = "D";
+        grades[70] = "C";
+        grades[80] = "B";
+        grades[90] = "A";
+
+        auto it = grades.lower_bound(75);
+        cout << "lower_bound(75): " << it->first << " -> " << it->second << endl;
+
+        it = grades.upper_bound(80);
+        cout << "upper_bound(80): " << it->first << " -> " << it->second << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: O(n) Bulk Load with insert_sorted ===" << endl;
+    {
+        // Presorted config data, the load-then-read-mostly workload
+        vector<pair<int, int>> sorted;
+        for (int i = 0; i < 100000; ++i)
+        {
+            sorted.push_back({i * 2, i});
+        }
+
+        flat_map<int, int> config;
+        config.reserve(sorted.size());
+
+        auto start = chrono::steady_clock::now();
+        config.insert_sorted(sorted.begin(), sorted.end());
+        auto us = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << "Bulk-loaded " << config.size() << " entries in " << us << " us" << endl;
+        cout << "No per-element search, no array shifting" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 4: Probe Latency vs std::map ===" << endl;
+    {
+        const int N = 1000000;
+        const int PROBES = 1000000;
+
+        map<int, int> rbTree;
+        flat_map<int, int> flat;
+        flat.reserve(N);
+
+        vector<pair<int, int>> sorted;
+        sorted.reserve(N);
+        for (int i = 0; i < N; ++i)
+        {
+            sorted.push_back({i * 3, i});
+        }
+        for (auto& kv : sorted) rbTree.insert(kv);
+        flat.insert_sorted(sorted.begin(), sorted.end());
+
+        // Random probe keys (mix of hits and misses)
+        mt19937 rng(42);
+        vector<int> probeKeys(PROBES);
+        for (int& k : probeKeys) k = (int)(rng() % (N * 3));
+
+        long long treeHits = 0;
+        auto start = chrono::steady_clock::now();
+        for (int k : probeKeys)
+        {
+            treeHits += rbTree.count(k);
+        }
+        auto treeNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        long long flatHits = 0;
+        start = chrono::steady_clock::now();
+        for (int k : probeKeys)
+        {
+            flatHits += flat.count(k);
+        }
+        auto flatNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << N << " keys, " << PROBES << " random probes:" << endl;
+        cout << "  std::map:  " << treeNs / PROBES << " ns/probe ("
+             << treeHits << " hits)" << endl;
+        cout << "  flat_map:  " << flatNs / PROBES << " ns/probe ("
+             << flatHits << " hits)" << endl;
+        cout << "Hit counts match: " << (treeHits == flatHits ? "OK" : "MISMATCH") << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 5: Lockstep Batch Lookup ===" << endl;
+    {
+        const int N = 4000000;            // out-of-cache key array
+        const int PROBES = 1000000;
+
+        flat_map<int, int> flat;
+        flat.reserve(N);
+        vector<pair<int, int>> sorted;
+        sorted.reserve(N);
+        for (int i = 0; i < N; ++i)
+        {
+            sorted.push_back({i * 3, i});
+        }
+        flat.insert_sorted(sorted.begin(), sorted.end());
+
+        mt19937 rng(7);
+        vector<int> probeKeys(PROBES);
+        for (int& k : probeKeys) k = (int)(rng() % (N * 3));
+
+        long long singleHits = 0;
+        auto start = chrono::steady_clock::now();
+        for (int k : probeKeys)
+        {
+            singleHits += flat.count(k);
+        }
+        auto singleNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        vector<int*> results(PROBES);
+        start = chrono::steady_clock::now();
+        flat.lookup_batch(probeKeys.data(), probeKeys.size(), results.data());
+        auto batchNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        long long batchHits = 0;
+        for (int* r : results) batchHits += (r != nullptr) ? 1 : 0;
+
+        cout << N << " keys, " << PROBES << " random probes:" << endl;
+        cout << "  one search per event: " << singleNs / PROBES << " ns/probe ("
+             << singleHits << " hits)" << endl;
+        cout << "  lookup_batch (16-way): " << batchNs / PROBES << " ns/probe ("
+             << batchHits << " hits)" << endl;
+        cout << "Hit counts match: "
+             << (singleHits == batchHits ? "OK" : "MISMATCH") << endl;
+        cout << "Each binary-search level prefetches all 16 next probes" << endl;
+        cout << "before consuming any — dependent misses become parallel" << endl;
+    }
+    cout << endl;
+
+    cout << "=== When to Use flat_map ===" << endl;
+    cout << "1. Load once (insert_sorted), then read millions of times" << endl;
+    cout << "2. Keys packed contiguously: branchless search, few misses" << endl;
+    cout << "3. int keys get an SSE2 scan over the final block" << endl;
+    cout << "4. Avoid when single-element inserts/erases dominate (O(n))" << endl;
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+### Bulk Load and Range Scans
+
+map_iterators.cpp walks maps one element at a time through
+begin()/end(). That is the right teaching model, but for analytics
+scans over millions of entries the per-element iterator overhead and
+tree-node cache misses dominate the runtime.
+
+This file shows the bulk interface grown onto flat_map:
+1. from_sorted_range(): build the whole map in one O(n) pass
+2. for_each_range(lo, hi, callback): visit a key range as one
+   contiguous block — the callback runs in a counted loop the
+   compiler can vectorize
+3. Scan throughput comparison against the std::map iterator loop
+
+*/
+
+#include <iostream>
+#include <map>
+#include <vector>
+#include <chrono>
+
+#include "flat_map.h"
+
+using namespace std;
+
+int main()
+{
+    cout << "=== Example 1: O(n) Bulk Construction ===" << endl;
+    {
+        vector<pair<int, int>> sorted;
+        for (int i = 0; i < 10; ++i)
+        {
+            sorted.push_back({i * 10, i * 100});
+        }
+
+        auto prices = flat_map<int, int>::from_sorted_range(sorted.begin(), sorted.end());
+        cout << "Built " << prices.size() << " entries in one pass" << endl;
+        cout << "Spot check: prices[50] = " << prices[50] << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Range Scan with a Callback ===" << endl;
+    {
+        vector<pair<int, int>> sorted;
+        for (int i = 0; i < 100; ++i)
+        {
+            sorted.push_back({i, i * i});
+        }
+        auto squares = flat_map<int, int>::from_sorted_range(sorted.begin(), sorted.end());
+
+        cout << "Entries with 10 <= key < 15:" << endl;
+        squares.for_each_range(10, 15, [](int key, int value) {
+            cout << "  " << key << " -> " << value << endl;
+        });
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Scan Throughput vs std::map Iterators ===" << endl;
+    {
+        const int N = 5000000;
+
+        vector<pair<int, long long>> sorted;
+        sorted.reserve(N);
+        for (int i = 0; i < N; ++i)
+        {
+            sorted.push_back({i, (long long)i * 2});
+        }
+
+        map<int, long long> rbTree(sorted.begin(), sorted.end());
+        auto flat = flat_map<int, long long>::from_sorted_range(
+            sorted.begin(), sorted.end());
+
+        // std::map: one tree-node hop per element
+        long long treeSum = 0;
+        auto start = chrono::steady_clock::now();
+        for (auto it = rbTree.begin(); it != rbTree.end(); ++it)
+        {
+            treeSum += it->second;
+        }
+        auto treeMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        // flat_map: a counted loop over two packed arrays
+        long long flatSum = 0;
+        start = chrono::steady_clock::now();
+        flat.for_each_range(0, N, [&flatSum](int, long long value) {
+            flatSum += value;
+        });
+        auto flatMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << "Summing " << N << " values:" << endl;
+        cout << "  std::map iterator loop:     " << treeMs << " ms" << endl;
+        cout << "  flat_map for_each_range:    " << flatMs << " ms" << endl;
+        cout << "Sums match: " << (treeSum == flatSum ? "OK" : "MISMATCH") << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. from_sorted_range: no per-element insert, one layout pass" << endl;
+    cout << "2. for_each_range: two binary searches bound the block," << endl;
+    cout << "   then a plain loop visits it — no iterator per element" << endl;
+    cout << "3. Contiguous data turns a pointer chase into streaming reads" << endl;
+
+    return 0;
+}
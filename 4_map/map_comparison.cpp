@@ -86,11 +86,25 @@ Note: Lexicographical comparison for maps:
 - First compares by keys (alphabetically for strings, numerically for numbers)
 - If keys are equal, compares by values
 - Shorter map is less if all elements match
+
+
+### Measured cost
+The "Measured" section at the end is the number that actually drives
+container choice: probe latency of std::map (pointer-chasing red-black
+tree) vs a sorted vector searched with lower_bound (binary search over
+contiguous memory), at 1K / 100K / 1M keys, via the shared bench.h
+harness. CSV output lets the numbers be tracked across toolchain bumps.
 */
 
 #include <iostream>
 #include <map>
 #include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+
+#include "../bench.h"
 
 using namespace std;
 
@@ -184,6 +198,57 @@ int main()
     cout << "v1 < v3: " << (v1 < v3 ? "true" : "false") << " (10 < 15 for X)" << endl;
     cout << "v2 > v1: " << (v2 > v1 ? "true" : "false") << endl;
     cout << "v3 > v1: " << (v3 > v1 ? "true" : "false") << endl;
+    cout << endl;
+
+    // The number that drives container choice: probe latency of a
+    // red-black tree (pointer chase per level) vs binary search over
+    // a contiguous sorted vector (same O(log n), far fewer misses)
+    cout << "=== Measured: std::map vs Sorted Vector Probe Latency ===" << endl;
+    {
+        for (size_t keyCount : {(size_t)1000, (size_t)100000, (size_t)1000000})
+        {
+            map<int, int> tree;
+            vector<pair<int, int>> sorted;
+            sorted.reserve(keyCount);
+            for (size_t i = 0; i < keyCount; ++i)
+            {
+                int key = (int)(i * 2);     // even keys, gaps between them
+                tree[key] = (int)i;
+                sorted.push_back({key, (int)i});
+            }
+
+            // Probe in a scattered order so the walk down the tree is
+            // not a warm replay of the previous lookup
+            vector<int> probes(keyCount);
+            for (size_t i = 0; i < keyCount; ++i)
+            {
+                probes[i] = (int)(((i * 2654435761u) % keyCount) * 2);
+            }
+
+            // No commas in names: they go into the CSV output verbatim
+            string label = to_string(keyCount) + " keys";
+            string mapName = "std::map probe " + label;
+            string vecName = "sorted vector probe " + label;
+
+            BENCH(mapName.c_str())
+            {
+                auto it = tree.find(probes[bench_i % probes.size()]);
+                bench::doNotOptimize(it->second);
+            };
+
+            BENCH(vecName.c_str())
+            {
+                int key = probes[bench_i % probes.size()];
+                auto it = lower_bound(sorted.begin(), sorted.end(), key,
+                                      [](const pair<int, int>& p, int k)
+                                      { return p.first < k; });
+                bench::doNotOptimize(it->second);
+            };
+        }
+
+        bench::reportTable();
+        bench::reportCsv();
+    }
 
     return 0;
 }
@@ -0,0 +1,161 @@
+/*
+### Zero-Deserialization Startup via Memory Mapping
+
+The maps in map.cpp and the vectors in 2_vector are rebuilt from
+scratch every process start. This example uses persist.h to write a
+flat_map and a ChunkedVector into the page-aligned, offset-based file
+format once, then "restarts" by memory-mapping the file:
+
+1. Build a 2M-entry flat_map the normal way and persist it
+2. Reopen as MappedFlatMap — open cost is a handful of microseconds
+   regardless of data size, because nothing is parsed or copied; the
+   kernel faults pages in as probes touch them
+3. Same round trip for ChunkedVector -> MappedChunkedVector
+4. Probe results from the mapped view checked against the live map
+
+The build step stands in for the 90-second deserialization pass a
+real service would pay on every deploy; the mapped open is the
+replacement.
+*/
+
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+#include "../persist.h"
+#include "flat_map.h"
+#include "../2_vector/chunked_vector.h"
+
+using namespace std;
+
+static long long usSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration_cast<chrono::microseconds>(
+        chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    const char* mapPath = "mapped_demo_map.bin";
+    const char* vecPath = "mapped_demo_vec.bin";
+    const size_t ENTRIES = 2000000;
+
+    cout << "=== Example 1: Build Once, Persist ===" << endl;
+    flat_map<int, long long> live;
+    {
+        auto start = chrono::steady_clock::now();
+        vector<pair<int, long long>> rows;
+        rows.reserve(ENTRIES);
+        for (size_t i = 0; i < ENTRIES; ++i)
+        {
+            rows.push_back({(int)(i * 2), (long long)(i * i)});
+        }
+        live = flat_map<int, long long>::from_sorted_range(rows.begin(), rows.end());
+        auto buildUs = usSince(start);
+
+        start = chrono::steady_clock::now();
+        Persist::Writer writer;
+        writer.addSection("keys", live.keys().data(), live.keys().size());
+        writer.addSection("values", live.values().data(), live.values().size());
+        writer.finish(mapPath);
+        auto writeUs = usSince(start);
+
+        cout << ENTRIES << " entries built in " << buildUs / 1000 << " ms, "
+             << "persisted in " << writeUs / 1000 << " ms" << endl;
+        cout << "(the build is the cost a restart normally repays in full)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Reopen by Mapping — the Restart Path ===" << endl;
+    {
+        auto start = chrono::steady_clock::now();
+        Persist::MappedFile file(mapPath);
+        Persist::MappedFlatMap<int, long long> mapped(file);
+        auto openUs = usSince(start);
+
+        cout << "Mapped open of " << file.fileBytes() / (1024 * 1024)
+             << " MB: " << openUs << " us — independent of data size" << endl;
+
+        // Probes against the mapped view, verified against the live map
+        size_t checked = 0, agreed = 0;
+        for (size_t i = 0; i < ENTRIES; i += 9973)
+        {
+            int key = (int)(i * 2);
+            const long long* hit = mapped.find(key);
+            auto liveIt = live.find(key);
+            if (hit != nullptr && liveIt != live.end() && *hit == liveIt->second)
+            {
+                ++agreed;
+            }
+            ++checked;
+        }
+        cout << "Scattered probes vs live map: " << agreed << "/" << checked
+             << " agree" << endl;
+        cout << "Misses behave too: find(1) = "
+             << (mapped.find(1) == nullptr ? "null (odd keys absent)" : "HIT?")
+             << endl;
+
+        // Range visit, same API shape as flat_map::for_each_range
+        long long rangeSum = 0;
+        size_t rangeCount = 0;
+        mapped.for_each_range(100, 120, [&](int, long long value) {
+            rangeSum += value;
+            ++rangeCount;
+        });
+        cout << "for_each_range(100, 120): " << rangeCount
+             << " entries, value sum " << rangeSum << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: ChunkedVector Round Trip ===" << endl;
+    {
+        const size_t N = 5000000;
+        ChunkedVector<double> cv;
+        cv.reserve(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            cv.push_back((double)i * 0.5);
+        }
+
+        // Chunks flatten into one contiguous section on disk
+        vector<double> contiguous;
+        contiguous.reserve(N);
+        cv.for_each_chunk([&](const double* begin, const double* end) {
+            contiguous.insert(contiguous.end(), begin, end);
+        });
+        Persist::Writer writer;
+        writer.addSection("data", contiguous.data(), contiguous.size());
+        writer.finish(vecPath);
+
+        auto start = chrono::steady_clock::now();
+        Persist::MappedFile file(vecPath);
+        Persist::MappedChunkedVector<double> mapped(file);
+        auto openUs = usSince(start);
+
+        bool match = mapped.size() == cv.size();
+        for (size_t i = 0; match && i < N; i += 997)
+        {
+            match = (mapped[i] == cv[i]);
+        }
+        cout << N << " doubles (" << file.fileBytes() / (1024 * 1024)
+             << " MB) reopened in " << openUs << " us" << endl;
+        cout << "Sampled elements match the source: "
+             << (match ? "OK" : "MISMATCH") << endl;
+        cout << "(mapped view is a flat array — even the chunk-table" << endl;
+        cout << " indirection is gone on the read side)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Offset-based sections, page-aligned: relocatable, mappable" << endl;
+    cout << "2. Open = one mmap + header check; data faults in lazily" << endl;
+    cout << "3. MappedFlatMap probes in place with flat_map's search" << endl;
+    cout << "4. Trivially copyable payloads only — pointers don't persist" << endl;
+
+    remove(mapPath);
+    remove(vecPath);
+    return 0;
+}
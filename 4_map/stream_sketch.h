@@ -0,0 +1,323 @@
+/*
+### Streaming Frequency Sketches
+
+The word-count idiom — counts[key]++ in a std::map — is exact, but
+pays a node allocation per new key, rehash/rebalance stalls, and
+memory proportional to how many DISTINCT keys the stream contains.
+A telemetry aggregator usually needs neither exactness nor the full
+key census; it needs "roughly how often?" and "who are the heavy
+hitters?" in memory fixed at construction time:
+
+1. count_min_sketch — a DEPTH x width grid of counters. Each key
+   hashes to one counter per row (same hash, different row seed);
+   offer() increments its DEPTH counters, estimate() takes the MIN
+   across them. Collisions only inflate counts, so the estimate is
+   always >= the truth, and the overshoot is bounded: with width w,
+   at most 2n/w extra on an n-event stream per row, and all DEPTH
+   rows must collide for the error to stick. Memory never grows —
+   cardinality is the stream's problem, not the sketch's
+2. space_saving_topk — exact candidate tracking for the top K keys
+   in K fixed slots. A new key beyond capacity EVICTS the current
+   minimum and inherits its count as its error bound; a true heavy
+   hitter quickly outgrows the inherited noise. Guarantee: any key
+   with true count > n/K is in the table
+3. Both structures merge(): counter grids add cell-wise, top-K
+   tables combine and re-select. Give each ingest thread its own
+   pair and merge periodically — threads never contend on shared
+   counters, so ingestion scales with cores and the merged view
+   lags by at most one merge period
+
+offer_batch(keys, n) takes pointer+count like lookup_batch in
+fast_hash_map.h, hashing a window ahead of resolving it.
+*/
+
+#ifndef STREAM_SKETCH_H
+#define STREAM_SKETCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ### count_min_sketch: bounded-overshoot frequency estimates
+template<typename Key>
+class count_min_sketch
+{
+public:
+    static constexpr std::size_t DEPTH = 4;
+
+private:
+    std::size_t width;                  // power of two
+    std::size_t mask;
+    std::vector<std::uint32_t> grid;    // DEPTH rows x width counters
+    std::uint64_t eventCount = 0;
+
+    static std::size_t roundUpPow2(std::size_t n)
+    {
+        std::size_t p = 1;
+        while (p < n) p *= 2;
+        return p;
+    }
+
+    // One std::hash then a per-row splitmix64 finalize: DEPTH
+    // decorrelated indices for the price of one key hash
+    static std::uint64_t mix(std::uint64_t h, std::uint64_t seed)
+    {
+        h += seed * 0x9E3779B97F4A7C15ull;
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+        return h ^ (h >> 31);
+    }
+
+    std::size_t cell(std::uint64_t keyHash, std::size_t row) const
+    {
+        return row * width + (mix(keyHash, row + 1) & mask);
+    }
+
+public:
+    explicit count_min_sketch(std::size_t requestedWidth = 16384)
+        : width(roundUpPow2(requestedWidth)),
+          mask(width - 1),
+          grid(DEPTH * width, 0)
+    {
+    }
+
+    void offer(const Key& key, std::uint32_t increment = 1)
+    {
+        std::uint64_t h = std::hash<Key>{}(key);
+        for (std::size_t row = 0; row < DEPTH; ++row)
+        {
+            grid[cell(h, row)] += increment;
+        }
+        eventCount += increment;
+    }
+
+    // Batch ingestion: hash the whole window first, then touch the
+    // grid — the independent counter loads can overlap instead of
+    // each event serializing hash -> load -> increment
+    void offer_batch(const Key* keys, std::size_t n)
+    {
+        constexpr std::size_t WINDOW = 16;
+        std::uint64_t hashes[WINDOW];
+
+        std::size_t i = 0;
+        for (; i + WINDOW <= n; i += WINDOW)
+        {
+            for (std::size_t j = 0; j < WINDOW; ++j)
+            {
+                hashes[j] = std::hash<Key>{}(keys[i + j]);
+            }
+            for (std::size_t j = 0; j < WINDOW; ++j)
+            {
+                for (std::size_t row = 0; row < DEPTH; ++row)
+                {
+                    grid[cell(hashes[j], row)]++;
+                }
+            }
+        }
+        for (; i < n; ++i)
+        {
+            offer(keys[i]);
+        }
+        eventCount += (n / WINDOW) * WINDOW;
+    }
+
+    std::uint64_t estimate(const Key& key) const
+    {
+        std::uint64_t h = std::hash<Key>{}(key);
+        std::uint32_t best = grid[cell(h, 0)];
+        for (std::size_t row = 1; row < DEPTH; ++row)
+        {
+            best = std::min(best, grid[cell(h, row)]);
+        }
+        return best;
+    }
+
+    // Cell-wise add: the merged sketch estimates the concatenated
+    // stream. Widths must match (merge partners should be built with
+    // the same constructor arguments)
+    void merge(const count_min_sketch& other)
+    {
+        for (std::size_t i = 0; i < grid.size(); ++i)
+        {
+            grid[i] += other.grid[i];
+        }
+        eventCount += other.eventCount;
+    }
+
+    std::uint64_t events() const { return eventCount; }
+    std::size_t bytes() const { return grid.size() * sizeof(std::uint32_t); }
+};
+
+// ### space_saving_topk: heavy hitters in K fixed slots
+// Entries live in a min-heap on count, with a key -> heap position
+// index beside it: incrementing a tracked key and evicting the
+// minimum for a new one are both O(log K), so the per-event cost
+// does not scale with K
+template<typename Key>
+class space_saving_topk
+{
+public:
+    struct Entry
+    {
+        Key key{};
+        std::uint64_t count = 0;
+        std::uint64_t error = 0;        // inherited from the evicted min
+    };
+
+private:
+    std::size_t capacity;
+    std::vector<Entry> entries;                     // min-heap on count
+    std::unordered_map<Key, std::size_t> position;  // key -> heap index
+
+    void swapEntries(std::size_t a, std::size_t b)
+    {
+        std::swap(entries[a], entries[b]);
+        position[entries[a].key] = a;
+        position[entries[b].key] = b;
+    }
+
+    // Counts only grow, so a changed entry can only move DOWN the
+    // min-heap (away from the root)
+    void siftDown(std::size_t i)
+    {
+        while (true)
+        {
+            std::size_t left = 2 * i + 1;
+            std::size_t right = left + 1;
+            std::size_t smallest = i;
+            if (left < entries.size()
+                && entries[left].count < entries[smallest].count)
+            {
+                smallest = left;
+            }
+            if (right < entries.size()
+                && entries[right].count < entries[smallest].count)
+            {
+                smallest = right;
+            }
+            if (smallest == i) return;
+            swapEntries(i, smallest);
+            i = smallest;
+        }
+    }
+
+    void siftUp(std::size_t i)
+    {
+        while (i > 0)
+        {
+            std::size_t parent = (i - 1) / 2;
+            if (entries[parent].count <= entries[i].count) return;
+            swapEntries(i, parent);
+            i = parent;
+        }
+    }
+
+public:
+    explicit space_saving_topk(std::size_t k) : capacity(k)
+    {
+        entries.reserve(k);
+        position.reserve(k);
+    }
+
+    void offer(const Key& key, std::uint64_t increment = 1)
+    {
+        auto it = position.find(key);
+        if (it != position.end())
+        {
+            std::size_t i = it->second;
+            entries[i].count += increment;
+            siftDown(i);
+            return;
+        }
+        if (entries.size() < capacity)
+        {
+            entries.push_back(Entry{key, increment, 0});
+            position[key] = entries.size() - 1;
+            siftUp(entries.size() - 1);
+            return;
+        }
+        // Evict the heap root (the minimum): the newcomer inherits
+        // its count as the error bound — it can never be
+        // under-counted, and if it is a real heavy hitter its own
+        // traffic soon dwarfs the noise
+        std::uint64_t floor = entries[0].count;
+        position.erase(entries[0].key);
+        entries[0] = Entry{key, floor + increment, floor};
+        position[key] = 0;
+        siftDown(0);
+    }
+
+    void offer_batch(const Key* keys, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            offer(keys[i]);
+        }
+    }
+
+    // Combine two trackers: sum counts for shared keys, then keep
+    // the K largest of the union (the standard space-saving merge),
+    // rebuilt into heap order
+    void merge(const space_saving_topk& other)
+    {
+        std::vector<Entry> combined = entries;
+        for (const Entry& e : other.entries)
+        {
+            bool found = false;
+            for (Entry& mine : combined)
+            {
+                if (mine.key == e.key)
+                {
+                    mine.count += e.count;
+                    mine.error += e.error;
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) combined.push_back(e);
+        }
+        std::sort(combined.begin(), combined.end(),
+                  [](const Entry& a, const Entry& b) {
+                      return a.count > b.count;
+                  });
+        if (combined.size() > capacity) combined.resize(capacity);
+
+        entries = std::move(combined);
+        position.clear();
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            position[entries[i].key] = i;
+        }
+        // Descending-sorted is reverse heap order: heapify bottom-up
+        for (std::size_t i = entries.size() / 2; i-- > 0; )
+        {
+            siftDown(i);
+        }
+    }
+
+    // Descending by count; ties broken arbitrarily
+    std::vector<Entry> top() const
+    {
+        std::vector<Entry> sorted = entries;
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const Entry& a, const Entry& b) {
+                      return a.count > b.count;
+                  });
+        return sorted;
+    }
+
+    std::size_t size() const { return entries.size(); }
+
+    // Entries plus the key->position index, both capped at K
+    std::size_t bytes() const
+    {
+        return capacity * (sizeof(Entry)
+                           + sizeof(std::pair<const Key, std::size_t>));
+    }
+};
+
+#endif // STREAM_SKETCH_H
@@ -0,0 +1,272 @@
+/*
+### Streaming Sketch Demonstration
+
+Runs the fixed-memory aggregation structures from stream_sketch.h
+against the exact counts[key]++ idiom on a skewed event stream:
+1. count_min_sketch estimates vs exact counts — overshoot is small
+   for heavy keys and bounded for everyone, at a fraction of the
+   map's memory
+2. space_saving_topk finds the true heavy hitters in K fixed slots
+3. Ingest throughput: batch sketch offers vs per-event map inserts
+4. Per-thread sketches with periodic merges vs one mutex-guarded
+   map — the sketch path shares nothing on the hot path
+*/
+
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "stream_sketch.h"
+
+using namespace std;
+
+// Skewed synthetic telemetry: 90% of events hit a small hot set of
+// IDs (skewed within the set), the rest scatter uniformly over the
+// whole universe — the shape real event-id streams have
+static vector<int> makeStream(size_t events, int distinct, unsigned seed)
+{
+    const int HOT = 100;
+    mt19937 rng(seed);
+    uniform_real_distribution<double> uni(0.0, 1.0);
+    vector<int> stream(events);
+    for (int& key : stream)
+    {
+        double u = uni(rng);
+        if (u < 0.9)
+        {
+            double v = u / 0.9;
+            key = (int)(v * v * HOT);       // skew inside the hot set
+        }
+        else
+        {
+            key = (int)(rng() % distinct);  // long uniform tail
+        }
+    }
+    return stream;
+}
+
+int main()
+{
+    const size_t EVENTS = 2000000;
+    const int DISTINCT = 100000;
+
+    vector<int> stream = makeStream(EVENTS, DISTINCT, 42);
+
+    // Exact reference counts, the map_functions.cpp idiom
+    unordered_map<int, uint64_t> exact;
+    for (int key : stream)
+    {
+        exact[key]++;
+    }
+
+    cout << "=== Example 1: Estimates vs Exact Counts ===" << endl;
+    {
+        count_min_sketch<int> sketch(16384);
+        sketch.offer_batch(stream.data(), stream.size());
+
+        cout << EVENTS << " events, " << exact.size()
+             << " distinct keys" << endl;
+        cout << "key      exact   estimate   overshoot" << endl;
+        for (int key : {0, 1, 2, 10, 100, 1000})
+        {
+            uint64_t truth = exact[key];
+            uint64_t est = sketch.estimate(key);
+            printf("%-6d %8llu %10llu %+11lld\n", key,
+                   (unsigned long long)truth, (unsigned long long)est,
+                   (long long)(est - truth));
+        }
+        cout << "Estimates never undershoot; collisions only add" << endl;
+
+        // Worst overshoot across every distinct key
+        uint64_t worst = 0;
+        for (const auto& kv : exact)
+        {
+            worst = max(worst, sketch.estimate(kv.first) - kv.second);
+        }
+        cout << "Worst overshoot over all " << exact.size() << " keys: "
+             << worst << " (" << (100.0 * worst) / EVENTS
+             << "% of the stream)" << endl;
+        cout << "Sketch memory: " << sketch.bytes() / 1024
+             << " KB fixed; the exact map holds " << exact.size()
+             << " nodes and grows with cardinality" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Space-Saving Top-K ===" << endl;
+    {
+        space_saving_topk<int> tracker(50);
+        tracker.offer_batch(stream.data(), stream.size());
+
+        // Exact top 10 for comparison
+        vector<pair<uint64_t, int>> ranked;
+        for (const auto& kv : exact)
+        {
+            ranked.push_back({kv.second, kv.first});
+        }
+        sort(ranked.rbegin(), ranked.rend());
+
+        auto top = tracker.top();
+        cout << "rank   exact(key,count)    tracked(key,count,err)" << endl;
+        int matches = 0;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            bool match = top[i].key == ranked[i].second;
+            matches += match ? 1 : 0;
+            printf("%4zu   %7d %9llu   %7d %9llu %5llu %s\n", i + 1,
+                   ranked[i].second, (unsigned long long)ranked[i].first,
+                   top[i].key, (unsigned long long)top[i].count,
+                   (unsigned long long)top[i].error, match ? "" : "  <- differs");
+        }
+        cout << "Top-10 agreement: " << matches << "/10 in "
+             << tracker.bytes() << " bytes (50 slots, "
+             << exact.size() << " distinct keys seen)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Ingest Throughput ===" << endl;
+    {
+        auto start = chrono::steady_clock::now();
+        unordered_map<int, uint64_t> counts;
+        for (int key : stream)
+        {
+            counts[key]++;
+        }
+        auto mapMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        count_min_sketch<int> sketch(16384);
+        start = chrono::steady_clock::now();
+        sketch.offer_batch(stream.data(), stream.size());
+        auto sketchMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << EVENTS << " events:" << endl;
+        cout << "  unordered_map counts[key]++: " << mapMs << " ms ("
+             << EVENTS / 1000 / max(1LL, (long long)mapMs) << "K events/ms)"
+             << endl;
+        cout << "  sketch offer_batch:          " << sketchMs << " ms ("
+             << EVENTS / 1000 / max(1LL, (long long)sketchMs)
+             << "K events/ms)" << endl;
+        cout << "No allocation, no rehash, no growth on the sketch path" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 4: Per-Thread Sketches, Periodic Merge ===" << endl;
+    {
+        const int THREADS = 4;
+        const size_t PER_THREAD = EVENTS / THREADS;
+        const size_t MERGE_PERIOD = 256 * 1024;
+
+        // Baseline: one shared map, locked per arriving batch of 1024
+        // events (a streaming aggregator can't hold the lock for the
+        // whole run — results must stay current)
+        unordered_map<int, uint64_t> shared;
+        mutex sharedGuard;
+        auto start = chrono::steady_clock::now();
+        {
+            vector<thread> workers;
+            for (int t = 0; t < THREADS; ++t)
+            {
+                workers.emplace_back([&, t] {
+                    vector<int> local = makeStream(PER_THREAD, DISTINCT, 100 + t);
+                    for (size_t done = 0; done < local.size(); done += 1024)
+                    {
+                        size_t n = min((size_t)1024, local.size() - done);
+                        lock_guard<mutex> lock(sharedGuard);
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            shared[local[done + i]]++;
+                        }
+                    }
+                });
+            }
+            for (thread& w : workers) w.join();
+        }
+        auto sharedMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        // Sketch path: private sketches, merged into the global view
+        // every MERGE_PERIOD events — contention only at merges
+        count_min_sketch<int> global(16384);
+        space_saving_topk<int> globalTop(50);
+        mutex globalGuard;
+        start = chrono::steady_clock::now();
+        {
+            vector<thread> workers;
+            for (int t = 0; t < THREADS; ++t)
+            {
+                workers.emplace_back([&, t] {
+                    vector<int> local = makeStream(PER_THREAD, DISTINCT, 100 + t);
+                    count_min_sketch<int> mine(16384);
+                    space_saving_topk<int> myTop(50);
+                    for (size_t done = 0; done < local.size(); done += MERGE_PERIOD)
+                    {
+                        size_t n = min(MERGE_PERIOD, local.size() - done);
+                        mine.offer_batch(local.data() + done, n);
+                        myTop.offer_batch(local.data() + done, n);
+
+                        lock_guard<mutex> lock(globalGuard);
+                        global.merge(mine);
+                        globalTop.merge(myTop);
+                        mine = count_min_sketch<int>(16384);
+                        myTop = space_saving_topk<int>(50);
+                    }
+                });
+            }
+            for (thread& w : workers) w.join();
+        }
+        auto sketchMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << THREADS << " threads x " << PER_THREAD << " events:" << endl;
+        cout << "  shared map under one mutex:   " << sharedMs << " ms" << endl;
+        cout << "  private sketches + merges:    " << sketchMs << " ms" << endl;
+        cout << "(sketch + top-K do more work per event, and a single" << endl;
+        cout << " core can't show the scaling — the point is the hot" << endl;
+        cout << " path never touches shared state, so cores add" << endl;
+        cout << " throughput instead of feeding one lock convoy, and" << endl;
+        cout << " the merged view lags by at most one merge period)" << endl;
+
+        // Correctness of the merged view against the shared map
+        uint64_t worst = 0;
+        for (const auto& kv : shared)
+        {
+            worst = max(worst, global.estimate(kv.first) - kv.second);
+        }
+        cout << "Merged sketch worst overshoot vs exact: " << worst << endl;
+
+        auto top = globalTop.top();
+        vector<pair<uint64_t, int>> ranked;
+        for (const auto& kv : shared)
+        {
+            ranked.push_back({kv.second, kv.first});
+        }
+        sort(ranked.rbegin(), ranked.rend());
+        int matches = 0;
+        for (size_t i = 0; i < 5; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                if (top[i].key == ranked[j].second) { matches++; break; }
+            }
+        }
+        cout << "Merged top-5 overlap with exact top-5: " << matches
+             << "/5" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Memory is fixed at construction — cardinality can't grow it" << endl;
+    cout << "2. Estimates only overshoot, and the overshoot is bounded" << endl;
+    cout << "3. Space-saving keeps every key whose count exceeds n/K" << endl;
+    cout << "4. Per-thread sketch + periodic merge: contention-free ingest" << endl;
+
+    return 0;
+}
@@ -0,0 +1,516 @@
+/*
+### Stack-Machine Bytecode Evaluator
+
+stack_functions.cpp and stack_operations.cpp show push/pop mechanics;
+this file shows what production code actually runs on top of a stack:
+an expression evaluator (think rules-engine formulas evaluated
+millions of times per second against changing inputs).
+
+The expensive way is to walk an AST per evaluation — every node is a
+heap object, every step a pointer chase and a branch on node type.
+This module compiles ONCE and evaluates a flat program many times:
+
+1. Compile: tokenize the infix expression, convert to postfix with
+   the shunting-yard algorithm, emit a flat opcode array
+2. Constant folding at compile time: when both operands of an
+   operator are constants, the compiler computes the result and
+   emits one PUSH instead of three instructions
+3. Evaluate: computed-goto dispatch (GCC labels-as-values, with a
+   portable switch fallback) over a CONTIGUOUS value stack — no
+   allocation, no pointer chasing, one sequential read, and one
+   predictable indirect branch per opcode handler
+4. Variables are slots resolved at compile time, so re-evaluating
+   with new inputs is just writing the slot array
+
+The demo measures the AST-walking baseline against the bytecode loop
+on the same formula.
+
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <stack>
+#include <chrono>
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std;
+
+// === Bytecode ===
+
+enum class Op : uint8_t
+{
+    PushConst,      // push operand
+    LoadVar,        // push variables[slot]
+    Add, Sub, Mul, Div,
+    Negate
+};
+
+struct Instruction
+{
+    Op op;
+    uint8_t slot;       // LoadVar
+    double value;       // PushConst
+};
+
+// === Compiler: infix -> postfix -> folded bytecode ===
+
+class Compiler
+{
+private:
+    struct Token
+    {
+        enum Kind { Number, Variable, Operator, LeftParen, RightParen } kind;
+        double number = 0;
+        string name;
+        char symbol = 0;
+    };
+
+    map<string, uint8_t>& variableSlots;
+
+    static int precedence(char symbol)
+    {
+        return (symbol == '+' || symbol == '-') ? 1 : 2;
+    }
+
+    vector<Token> tokenize(const string& text)
+    {
+        vector<Token> tokens;
+        size_t i = 0;
+        while (i < text.size())
+        {
+            char c = text[i];
+            if (isspace((unsigned char)c))
+            {
+                ++i;
+            }
+            else if (isdigit((unsigned char)c) || c == '.')
+            {
+                size_t used = 0;
+                Token t;
+                t.kind = Token::Number;
+                t.number = stod(text.substr(i), &used);
+                tokens.push_back(t);
+                i += used;
+            }
+            else if (isalpha((unsigned char)c) || c == '_')
+            {
+                size_t start = i;
+                while (i < text.size() &&
+                       (isalnum((unsigned char)text[i]) || text[i] == '_'))
+                {
+                    ++i;
+                }
+                Token t;
+                t.kind = Token::Variable;
+                t.name = text.substr(start, i - start);
+                tokens.push_back(t);
+            }
+            else if (c == '(')
+            {
+                tokens.push_back(Token{Token::LeftParen, 0, "", '('});
+                ++i;
+            }
+            else if (c == ')')
+            {
+                tokens.push_back(Token{Token::RightParen, 0, "", ')'});
+                ++i;
+            }
+            else if (c == '+' || c == '-' || c == '*' || c == '/')
+            {
+                // Unary minus: '-' at the start or after '(' / operator
+                bool unary = (c == '-') &&
+                             (tokens.empty() ||
+                              tokens.back().kind == Token::Operator ||
+                              tokens.back().kind == Token::LeftParen);
+                Token t;
+                t.kind = Token::Operator;
+                t.symbol = unary ? '~' : c;
+                tokens.push_back(t);
+                ++i;
+            }
+            else
+            {
+                throw runtime_error(string("unexpected character: ") + c);
+            }
+        }
+        return tokens;
+    }
+
+    // Emit with constant folding: if the instruction(s) feeding an
+    // operator are PushConst, compute now and emit one PushConst
+    static void emitOperator(vector<Instruction>& code, char symbol)
+    {
+        size_t n = code.size();
+        if (symbol == '~')
+        {
+            if (n >= 1 && code[n - 1].op == Op::PushConst)
+            {
+                code[n - 1].value = -code[n - 1].value;
+                return;
+            }
+            code.push_back(Instruction{Op::Negate, 0, 0});
+            return;
+        }
+
+        if (n >= 2 && code[n - 1].op == Op::PushConst &&
+            code[n - 2].op == Op::PushConst)
+        {
+            double rhs = code[n - 1].value;
+            double lhs = code[n - 2].value;
+            code.pop_back();
+            switch (symbol)
+            {
+                case '+': code.back().value = lhs + rhs; break;
+                case '-': code.back().value = lhs - rhs; break;
+                case '*': code.back().value = lhs * rhs; break;
+                case '/': code.back().value = lhs / rhs; break;
+            }
+            return;
+        }
+
+        Op op = symbol == '+' ? Op::Add
+              : symbol == '-' ? Op::Sub
+              : symbol == '*' ? Op::Mul
+              : Op::Div;
+        code.push_back(Instruction{op, 0, 0});
+    }
+
+public:
+    explicit Compiler(map<string, uint8_t>& slots) : variableSlots(slots) {}
+
+    // Shunting-yard straight into the emitter — operands and folded
+    // constants flow to `code`, pending operators wait on `operators`
+    vector<Instruction> compile(const string& expression)
+    {
+        vector<Instruction> code;
+        stack<char> operators;
+
+        for (const Token& t : tokenize(expression))
+        {
+            switch (t.kind)
+            {
+                case Token::Number:
+                    code.push_back(Instruction{Op::PushConst, 0, t.number});
+                    break;
+
+                case Token::Variable:
+                {
+                    auto found = variableSlots.find(t.name);
+                    if (found == variableSlots.end())
+                    {
+                        uint8_t slot = (uint8_t)variableSlots.size();
+                        found = variableSlots.insert({t.name, slot}).first;
+                    }
+                    code.push_back(Instruction{Op::LoadVar, found->second, 0});
+                    break;
+                }
+
+                case Token::Operator:
+                    while (!operators.empty() && operators.top() != '(' &&
+                           (t.symbol == '~'
+                                ? false     // unary binds tightest
+                                : precedence(operators.top() == '~' ? '*' : operators.top())
+                                      >= precedence(t.symbol)))
+                    {
+                        emitOperator(code, operators.top());
+                        operators.pop();
+                    }
+                    operators.push(t.symbol);
+                    break;
+
+                case Token::LeftParen:
+                    operators.push('(');
+                    break;
+
+                case Token::RightParen:
+                    while (!operators.empty() && operators.top() != '(')
+                    {
+                        emitOperator(code, operators.top());
+                        operators.pop();
+                    }
+                    if (operators.empty())
+                    {
+                        throw runtime_error("unmatched )");
+                    }
+                    operators.pop();
+                    break;
+            }
+        }
+        while (!operators.empty())
+        {
+            if (operators.top() == '(')
+            {
+                throw runtime_error("unmatched (");
+            }
+            emitOperator(code, operators.top());
+            operators.pop();
+        }
+        return code;
+    }
+};
+
+// === The VM: switch dispatch over a contiguous value stack ===
+
+double evaluate(const vector<Instruction>& code, const double* variables)
+{
+    double valueStack[64];
+    double* top = valueStack;       // points one past the top value
+    const Instruction* ip = code.data();
+    const Instruction* end = ip + code.size();
+
+#if defined(__GNUC__)
+    // Computed goto: each opcode handler jumps straight to the next
+    // handler, so the branch predictor gets one indirect branch per
+    // opcode instead of a single shared switch branch
+    static const void* dispatch[] = {
+        &&doPushConst, &&doLoadVar, &&doAdd, &&doSub, &&doMul, &&doDiv, &&doNegate
+    };
+
+    #define DISPATCH() do { if (ip == end) return top[-1]; \
+                            goto *dispatch[(int)(ip->op)]; } while (0)
+
+    if (ip == end) return 0;
+    goto *dispatch[(int)(ip->op)];
+doPushConst: *top++ = ip->value; ++ip; DISPATCH();
+doLoadVar:   *top++ = variables[ip->slot]; ++ip; DISPATCH();
+doAdd: top[-2] = top[-2] + top[-1]; --top; ++ip; DISPATCH();
+doSub: top[-2] = top[-2] - top[-1]; --top; ++ip; DISPATCH();
+doMul: top[-2] = top[-2] * top[-1]; --top; ++ip; DISPATCH();
+doDiv: top[-2] = top[-2] / top[-1]; --top; ++ip; DISPATCH();
+doNegate: top[-1] = -top[-1]; ++ip; DISPATCH();
+
+    #undef DISPATCH
+#else
+    for (; ip != end; ++ip)
+    {
+        switch (ip->op)
+        {
+            case Op::PushConst: *top++ = ip->value; break;
+            case Op::LoadVar:   *top++ = variables[ip->slot]; break;
+            case Op::Add: top[-2] = top[-2] + top[-1]; --top; break;
+            case Op::Sub: top[-2] = top[-2] - top[-1]; --top; break;
+            case Op::Mul: top[-2] = top[-2] * top[-1]; --top; break;
+            case Op::Div: top[-2] = top[-2] / top[-1]; --top; break;
+            case Op::Negate: top[-1] = -top[-1]; break;
+        }
+    }
+    return top[-1];
+#endif
+}
+
+static void listBytecode(const vector<Instruction>& code,
+                         const map<string, uint8_t>& slots)
+{
+    for (const Instruction& instr : code)
+    {
+        switch (instr.op)
+        {
+            case Op::PushConst: cout << "  PUSH " << instr.value << endl; break;
+            case Op::LoadVar:
+                for (const auto& entry : slots)
+                {
+                    if (entry.second == instr.slot)
+                    {
+                        cout << "  LOAD " << entry.first << endl;
+                    }
+                }
+                break;
+            case Op::Add: cout << "  ADD" << endl; break;
+            case Op::Sub: cout << "  SUB" << endl; break;
+            case Op::Mul: cout << "  MUL" << endl; break;
+            case Op::Div: cout << "  DIV" << endl; break;
+            case Op::Negate: cout << "  NEG" << endl; break;
+        }
+    }
+}
+
+// === AST baseline: what interpreting per evaluation costs ===
+
+struct AstNode
+{
+    char op;                    // 0 = constant, 'v' = variable
+    double value = 0;
+    uint8_t slot = 0;
+    unique_ptr<AstNode> left, right;
+
+    double eval(const double* variables) const
+    {
+        switch (op)
+        {
+            case 0:   return value;
+            case 'v': return variables[slot];
+            case '+': return left->eval(variables) + right->eval(variables);
+            case '-': return left->eval(variables) - right->eval(variables);
+            case '*': return left->eval(variables) * right->eval(variables);
+            default:  return left->eval(variables) / right->eval(variables);
+        }
+    }
+};
+
+// Rebuild the same program as a heap-node tree — what an interpreter
+// that never compiles would walk on every evaluation
+static unique_ptr<AstNode> astFromBytecode(const vector<Instruction>& code)
+{
+    vector<unique_ptr<AstNode>> nodes;
+    for (const Instruction& instr : code)
+    {
+        auto n = make_unique<AstNode>();
+        switch (instr.op)
+        {
+            case Op::PushConst:
+                n->op = 0;
+                n->value = instr.value;
+                break;
+            case Op::LoadVar:
+                n->op = 'v';
+                n->slot = instr.slot;
+                break;
+            case Op::Negate:
+                n->op = '-';
+                n->left = make_unique<AstNode>();
+                n->left->op = 0;
+                n->right = std::move(nodes.back());
+                nodes.pop_back();
+                break;
+            default:
+                n->op = instr.op == Op::Add ? '+'
+                      : instr.op == Op::Sub ? '-'
+                      : instr.op == Op::Mul ? '*' : '/';
+                n->right = std::move(nodes.back());
+                nodes.pop_back();
+                n->left = std::move(nodes.back());
+                nodes.pop_back();
+                break;
+        }
+        nodes.push_back(std::move(n));
+    }
+    return std::move(nodes.back());
+}
+
+int main()
+{
+    cout << "=== Example 1: Compile Once, Inspect the Bytecode ===" << endl;
+    {
+        map<string, uint8_t> slots;
+        Compiler compiler(slots);
+
+        auto code = compiler.compile("price * qty * (1 - discount) + shipping");
+        cout << "price * qty * (1 - discount) + shipping:" << endl;
+        listBytecode(code, slots);
+
+        double variables[4] = {0};
+        variables[slots["price"]] = 19.99;
+        variables[slots["qty"]] = 3;
+        variables[slots["discount"]] = 0.10;
+        variables[slots["shipping"]] = 4.95;
+        cout << "Evaluated: " << evaluate(code, variables) << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Constant Folding ===" << endl;
+    {
+        map<string, uint8_t> slots;
+        Compiler compiler(slots);
+
+        auto code = compiler.compile("(2 + 3) * x - 60 / (4 + 2)");
+        cout << "(2 + 3) * x - 60 / (4 + 2) compiles to "
+             << code.size() << " instructions:" << endl;
+        listBytecode(code, slots);
+
+        double x = 7;
+        cout << "x = 7: " << evaluate(code, &x) << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Correctness Spot Checks ===" << endl;
+    {
+        struct Case { const char* text; double expected; };
+        Case cases[] = {
+            {"3 + 4 * 2", 11},
+            {"(3 + 4) * 2", 14},
+            {"-5 + 10", 5},
+            {"2 * -3", -6},
+            {"100 / 4 / 5", 5},
+            {"1 - 2 - 3", -4},
+        };
+
+        for (const Case& c : cases)
+        {
+            map<string, uint8_t> slots;
+            double result = evaluate(Compiler(slots).compile(c.text), nullptr);
+            cout << "  " << c.text << " = " << result
+                 << (result == c.expected ? "" : "  MISMATCH") << endl;
+        }
+    }
+    cout << endl;
+
+    cout << "=== Example 4: Bytecode Loop vs AST Walk ===" << endl;
+    {
+        // A rules-engine-sized formula, not a toy one
+        map<string, uint8_t> slots;
+        Compiler compiler(slots);
+        auto code = compiler.compile(
+            "price * qty * (1 - discount) + shipping"
+            " + tax * price * qty - rebate * qty"
+            " + handling / (1 + surcharge)"
+            " + price * qty * loyalty * (1 - discount)"
+            " - (price - floor_price) * clearance");
+
+        // The identical program as a pointer-chased tree
+        auto ast = astFromBytecode(code);
+
+        const int EVALS = 5000000;
+        double variables[16] = {0};
+        variables[slots["price"]] = 19.99;
+        variables[slots["qty"]] = 3;
+        variables[slots["discount"]] = 0.10;
+        variables[slots["shipping"]] = 4.95;
+        variables[slots["tax"]] = 0.08;
+        variables[slots["rebate"]] = 0.50;
+        variables[slots["handling"]] = 2.25;
+        variables[slots["surcharge"]] = 0.03;
+        variables[slots["loyalty"]] = 0.02;
+        variables[slots["floor_price"]] = 14.99;
+        variables[slots["clearance"]] = 0.25;
+        uint8_t qtySlot = slots["qty"];
+
+        auto start = chrono::steady_clock::now();
+        double astSum = 0;
+        for (int i = 0; i < EVALS; ++i)
+        {
+            variables[qtySlot] = (double)(i & 7);
+            astSum += ast->eval(variables);
+        }
+        auto astMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        double vmSum = 0;
+        for (int i = 0; i < EVALS; ++i)
+        {
+            variables[qtySlot] = (double)(i & 7);
+            vmSum += evaluate(code, variables);
+        }
+        auto vmMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << EVALS << " evaluations with changing inputs:" << endl;
+        cout << "  AST walk:      " << astMs << " ms" << endl;
+        cout << "  bytecode loop: " << vmMs << " ms" << endl;
+        cout << "Sums match: " << (astSum == vmSum ? "OK" : "MISMATCH") << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Compile once: tokenize, shunting-yard, flat opcode array" << endl;
+    cout << "2. Constant subexpressions fold away at compile time" << endl;
+    cout << "3. Eval: computed-goto dispatch, contiguous stack, zero allocation" << endl;
+    cout << "4. Variables are slots — re-evaluation just rewrites an array" << endl;
+
+    return 0;
+}
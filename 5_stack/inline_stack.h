@@ -0,0 +1,135 @@
+/*
+### InlineStack<T, N> — Fixed-Capacity Inline Stack
+
+Every example in this directory sits on std::stack's default backing,
+std::deque — which allocates 512-byte blocks and reaches elements
+through a block pointer table. For the shallow, hot stacks parsers
+and evaluators actually use (depth 8-64, pushed and popped millions
+of times), that is an allocation on first push and a pointer chase
+per access.
+
+InlineStack keeps the common case on the stack frame itself:
+1. The first N elements live INLINE in the object — depth <= N never
+   touches the heap, and the top of stack shares cache lines with
+   whatever owns the stack
+2. Overflow past N spills to one CONTIGUOUS heap buffer (everything
+   moves over; doubling growth after that) — deep stacks still work,
+   they just pay what std::vector would
+3. push_unchecked() skips the capacity test for loops that validated
+   their bound up front — the push becomes a store and an increment
+4. Trivially copyable element types relocate with memcpy on spill
+
+stack_comparison.cpp measures this against std::stack over deque and
+vector backings.
+*/
+
+#ifndef INLINE_STACK_H
+#define INLINE_STACK_H
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename T, std::size_t N>
+class InlineStack
+{
+private:
+    alignas(T) unsigned char inlineStorage[N * sizeof(T)];
+    T* elements;                // inline storage, or the heap spill
+    std::size_t count = 0;
+    std::size_t cap = N;
+
+    bool isInline() const
+    {
+        return elements == (const T*)inlineStorage;
+    }
+
+    // Move everything into a larger heap buffer; memcpy when the
+    // element type allows it
+    void grow(std::size_t newCap)
+    {
+        T* bigger = (T*)::operator new(newCap * sizeof(T), std::align_val_t(alignof(T)));
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy((void*)bigger, (const void*)elements, count * sizeof(T));
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                new (bigger + i) T(std::move(elements[i]));
+                elements[i].~T();
+            }
+        }
+        if (!isInline())
+        {
+            ::operator delete((void*)elements, std::align_val_t(alignof(T)));
+        }
+        elements = bigger;
+        cap = newCap;
+    }
+
+public:
+    InlineStack() : elements((T*)inlineStorage) {}
+
+    ~InlineStack()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            elements[i].~T();
+        }
+        if (!isInline())
+        {
+            ::operator delete((void*)elements, std::align_val_t(alignof(T)));
+        }
+    }
+
+    InlineStack(const InlineStack&) = delete;
+    InlineStack& operator=(const InlineStack&) = delete;
+
+    void push(const T& value)
+    {
+        if (count == cap)
+        {
+            grow(cap * 2);
+        }
+        new (elements + count) T(value);
+        ++count;
+    }
+
+    void push(T&& value)
+    {
+        if (count == cap)
+        {
+            grow(cap * 2);
+        }
+        new (elements + count) T(std::move(value));
+        ++count;
+    }
+
+    // For loops whose depth bound is validated up front: no capacity
+    // test, just a store and an increment
+    void push_unchecked(const T& value)
+    {
+        new (elements + count) T(value);
+        ++count;
+    }
+
+    void pop()
+    {
+        --count;
+        elements[count].~T();
+    }
+
+    T& top() { return elements[count - 1]; }
+    const T& top() const { return elements[count - 1]; }
+
+    std::size_t size() const { return count; }
+    std::size_t capacity() const { return cap; }
+    bool empty() const { return count == 0; }
+    bool spilled() const { return !isInline(); }
+};
+
+#endif // INLINE_STACK_H
@@ -93,10 +93,25 @@ Note: Comparison is based on the underlying container
 - Elements are compared from bottom to top
 - First differing element determines the result
 
+
+### Measured cost
+Since everything here delegates to the underlying container, the
+underlying container IS the performance story. The "Measured" section
+at the end uses the shared bench.h harness to time push/pop and ==
+for the default deque backing vs a vector backing, and both against
+InlineStack<T, N> (inline_stack.h) — a fixed-capacity stack whose
+first N elements live in the object itself, so shallow hot stacks
+never allocate at all.
+
 */
 
 #include <iostream>
 #include <stack>
+#include <vector>
+#include <cstddef>
+
+#include "../bench.h"
+#include "inline_stack.h"
 
 using namespace std;
 
@@ -246,6 +261,118 @@ int main()
     cout << "a < c: " << (a < c ? "true" : "false") << " (2 < 3 at second position)" << endl;
     cout << "a < d: " << (a < d ? "true" : "false") << " (a is prefix of d)" << endl;
     cout << "d > a: " << (d > a ? "true" : "false") << " (longer with same prefix)" << endl;
+    cout << endl;
+
+    // The shallow-stack specialist: inline storage for depth <= N,
+    // one contiguous spill buffer past that
+    cout << "=== InlineStack Semantics ===" << endl;
+    {
+        InlineStack<int, 8> s;
+        for (int i = 0; i < 8; ++i) s.push(i);
+        cout << "8 pushes into InlineStack<int, 8>: "
+             << (s.spilled() ? "spilled (BUG)" : "still inline, zero heap") << endl;
+
+        s.push(8);
+        cout << "9th push: " << (s.spilled() ? "spilled to one contiguous buffer"
+                                             : "inline (BUG)")
+             << ", capacity " << s.capacity() << endl;
+
+        int sum = 0;
+        while (!s.empty())
+        {
+            sum += s.top();
+            s.pop();
+        }
+        cout << "Drained, sum = " << sum << " (expect 36)" << endl;
+    }
+    cout << endl;
+
+    // The operators delegate to the backing container, so the backing
+    // container decides the cost: deque (default) vs vector
+    cout << "=== Measured: Backing Container Cost ===" << endl;
+    {
+        const size_t DEPTH = 1000;
+
+        BENCH("stack<int deque> push+pop x1000")
+        {
+            (void)bench_i;
+            stack<int> s;
+            for (size_t i = 0; i < DEPTH; ++i) s.push((int)i);
+            while (!s.empty()) s.pop();
+            bench::doNotOptimize(s);
+        };
+
+        BENCH("stack<int vector> push+pop x1000")
+        {
+            (void)bench_i;
+            stack<int, vector<int>> s;
+            for (size_t i = 0; i < DEPTH; ++i) s.push((int)i);
+            while (!s.empty()) s.pop();
+            bench::doNotOptimize(s);
+        };
+
+        BENCH("InlineStack<int 1024> push+pop x1000")
+        {
+            (void)bench_i;
+            InlineStack<int, 1024> s;
+            for (size_t i = 0; i < DEPTH; ++i) s.push((int)i);
+            while (!s.empty()) s.pop();
+            bench::doNotOptimize(s);
+        };
+
+        BENCH("InlineStack push_unchecked x1000")
+        {
+            (void)bench_i;
+            InlineStack<int, 1024> s;        // bound validated: 1000 <= 1024
+            for (size_t i = 0; i < DEPTH; ++i) s.push_unchecked((int)i);
+            while (!s.empty()) s.pop();
+            bench::doNotOptimize(s);
+        };
+
+        // The parser profile: shallow stack, worked hard
+        BENCH("stack<int deque> depth-16 churn")
+        {
+            stack<int> s;
+            for (int i = 0; i < 16; ++i) s.push((int)bench_i + i);
+            while (!s.empty()) s.pop();
+            bench::doNotOptimize(s);
+        };
+
+        BENCH("InlineStack<int 16> depth-16 churn")
+        {
+            InlineStack<int, 16> s;
+            for (int i = 0; i < 16; ++i) s.push_unchecked((int)bench_i + i);
+            while (!s.empty()) s.pop();
+            bench::doNotOptimize(s);
+        };
+
+        stack<int> dq1, dq2;
+        stack<int, vector<int>> vec1, vec2;
+        for (size_t i = 0; i < 100000; ++i)
+        {
+            dq1.push((int)i);
+            dq2.push((int)i);
+            vec1.push((int)i);
+            vec2.push((int)i);
+        }
+
+        BENCH("stack== 100K deque backing")
+        {
+            (void)bench_i;
+            bool eq = (dq1 == dq2);
+            bench::doNotOptimize(eq);
+        };
+
+        BENCH("stack== 100K vector backing")
+        {
+            (void)bench_i;
+            bool eq = (vec1 == vec2);
+            bench::doNotOptimize(eq);
+        };
+
+        bench::reportTable();
+        bench::reportCsv();
+    }
 
     return 0;
 }
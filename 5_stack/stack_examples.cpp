@@ -18,11 +18,15 @@
 
 ### Example 3: Undo/Redo Functionality
 - Problem: Implement undo/redo operations (like in text editors).
-- Solution: Use two stacks - one for undo, one for redo.
+- Solution: A piece table plus two stacks of O(1) edit records.
+- Why not snapshot the whole document per edit? That costs
+  O(document size) per keystroke — quadratic for a busy editor.
 - Algorithm:
-  1. When action performed, push to undo stack
-  2. When undo called, pop from undo stack and push to redo stack
-  3. When redo called, pop from redo stack and push to undo stack
+  1. All typed text is appended once to an append-only buffer
+  2. The document is a list of pieces (offset, length) into that buffer
+  3. type() adds one piece and pushes a tiny record to the undo stack
+  4. undo()/redo() move piece records between the two stacks in O(1)
+  5. compact() coalesces adjacent pieces that touch in the buffer
 
 
 ### Example 4: Decimal to Binary Conversion
@@ -50,6 +54,7 @@
 #include <iostream>
 #include <stack>
 #include <string>
+#include <vector>
 #include <cctype> // for isdigit
 
 using namespace std;
@@ -112,21 +117,37 @@ string reverseString(const string &text)
     return reversed;
 }
 
-// Example 3: Simple Undo System
+// Example 3: Undo System Backed by a Piece Table
 class TextEditor
 {
 private:
-    stack<string> undoStack;
-    stack<string> redoStack;
-    string currentText;
+    // A piece is a run of characters inside the append-only buffer.
+    // The document is the concatenation of all pieces in order.
+    struct Piece
+    {
+        size_t offset; // where the run starts in addBuffer
+        size_t length; // how many characters it covers
+    };
+
+    string addBuffer;     // every character ever typed, appended once
+    vector<Piece> pieces; // current document = pieces in order
+
+    // An edit record is just "one piece was appended" — a few dozen
+    // bytes regardless of document size
+    stack<Piece> undoStack;
+    stack<Piece> redoStack;
 
 public:
-    TextEditor() : currentText("") {}
+    TextEditor() {}
 
     void type(const string &text)
     {
-        undoStack.push(currentText); // Save current state
-        currentText += text;
+        // The text itself is written exactly once, ever
+        Piece piece{addBuffer.size(), text.size()};
+        addBuffer += text;
+        pieces.push_back(piece);
+        undoStack.push(piece);
+
         // Clear redo stack when new action performed
         while (!redoStack.empty())
         {
@@ -138,9 +159,11 @@ public:
     {
         if (!undoStack.empty())
         {
-            redoStack.push(currentText); // Save current for redo
-            currentText = undoStack.top();
+            // O(1): drop the last piece, remember it for redo.
+            // The characters stay in addBuffer untouched.
+            redoStack.push(undoStack.top());
             undoStack.pop();
+            pieces.pop_back();
         }
         else
         {
@@ -152,8 +175,9 @@ public:
     {
         if (!redoStack.empty())
         {
-            undoStack.push(currentText); // Save current for undo
-            currentText = redoStack.top();
+            // O(1): re-attach the piece — no text is copied
+            pieces.push_back(redoStack.top());
+            undoStack.push(redoStack.top());
             redoStack.pop();
         }
         else
@@ -162,10 +186,43 @@ public:
         }
     }
 
+    // Coalesce adjacent pieces whose runs touch in the buffer, so a
+    // long typing session collapses back to a handful of pieces.
+    // Old edit records describe the pre-merge pieces, so compacting
+    // also collapses the undo/redo history (like "save" in an editor).
+    void compact()
+    {
+        while (!undoStack.empty()) undoStack.pop();
+        while (!redoStack.empty()) redoStack.pop();
+
+        vector<Piece> merged;
+        for (const Piece &piece : pieces)
+        {
+            if (!merged.empty() &&
+                merged.back().offset + merged.back().length == piece.offset)
+            {
+                merged.back().length += piece.length;
+            }
+            else
+            {
+                merged.push_back(piece);
+            }
+        }
+        pieces = std::move(merged);
+    }
+
     string getText() const
     {
-        return currentText;
+        // Only materialized on demand — editing never does this
+        string text;
+        for (const Piece &piece : pieces)
+        {
+            text.append(addBuffer, piece.offset, piece.length);
+        }
+        return text;
     }
+
+    size_t pieceCount() const { return pieces.size(); }
 };
 
 // Example 4: Decimal to Binary Conversion
@@ -311,6 +368,13 @@ int main()
     cout << "After typing ' C++': \"" << editor.getText() << "\"" << endl;
 
     editor.redo(); // Should show "Nothing to redo"
+
+    cout << "Pieces before compact: " << editor.pieceCount() << endl;
+    editor.compact();
+    cout << "Pieces after compact: " << editor.pieceCount()
+         << " (adjacent runs coalesced)" << endl;
+    cout << "Text unchanged: \"" << editor.getText() << "\"" << endl;
+    cout << "Each undo record is a (offset, length) pair, not a copy" << endl;
     cout << endl;
 
     cout << "=== Example 4: Decimal to Binary Conversion ===" << endl;
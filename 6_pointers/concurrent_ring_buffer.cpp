@@ -0,0 +1,396 @@
+/*
+### Concurrent Ring Buffers
+
+The CircularBuffer in pointer_examples.cpp is single-threaded. This file
+adds the concurrent variants used for thread hand-off queues:
+1. SPSC mode: wait-free single-producer/single-consumer ring using
+   atomics with acquire/release ordering — no locks, no CAS
+2. Cache-line padding on the head/tail indices to kill false sharing
+3. MPMC mode: multi-producer/multi-consumer ring with a per-slot
+   ticket (sequence number) scheme
+4. Batch push_n()/pop_n() so one atomic update covers a whole burst
+
+
+### Why acquire/release ordering?
+- The producer's store to tail "publishes" the written slots
+- The consumer's acquire load of tail guarantees it sees the data
+- Sequentially consistent ordering would add fences we don't need
+
+
+### Why pad head and tail?
+- If both indices share a cache line, producer and consumer cores
+  bounce that line on every operation (false sharing)
+- 64-byte padding gives each index its own line
+
+*/
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+
+using namespace std;
+
+constexpr size_t CACHE_LINE = 64;
+
+// === SPSC Ring Buffer (wait-free) ===
+
+template<typename T>
+class SpscRingBuffer
+{
+private:
+    vector<T> buffer;
+    size_t mask;                                    // capacity - 1 (power of two)
+
+    // Each index on its own cache line: producer writes tail,
+    // consumer writes head, and neither invalidates the other's line
+    alignas(CACHE_LINE) atomic<size_t> head{0};     // next slot to read
+    alignas(CACHE_LINE) atomic<size_t> tail{0};     // next slot to write
+
+    // Local caches of the other side's index: re-read the atomic only
+    // when the cached value says the buffer looks full/empty
+    alignas(CACHE_LINE) size_t cachedHead{0};       // producer's view of head
+    alignas(CACHE_LINE) size_t cachedTail{0};       // consumer's view of tail
+
+public:
+    // capacity must be a power of two
+    SpscRingBuffer(size_t capacity) : buffer(capacity), mask(capacity - 1)
+    {
+    }
+
+    bool push(const T& value)
+    {
+        size_t t = tail.load(memory_order_relaxed);
+        if (t - cachedHead == buffer.size())
+        {
+            cachedHead = head.load(memory_order_acquire);
+            if (t - cachedHead == buffer.size())
+                return false;                       // full
+        }
+
+        buffer[t & mask] = value;
+        tail.store(t + 1, memory_order_release);    // publish
+        return true;
+    }
+
+    bool pop(T& value)
+    {
+        size_t h = head.load(memory_order_relaxed);
+        if (h == cachedTail)
+        {
+            cachedTail = tail.load(memory_order_acquire);
+            if (h == cachedTail)
+                return false;                       // empty
+        }
+
+        value = buffer[h & mask];
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+
+    // Batch variants: one atomic store publishes the whole burst
+    size_t push_n(const T* values, size_t count)
+    {
+        size_t t = tail.load(memory_order_relaxed);
+        size_t freeSlots = buffer.size() - (t - cachedHead);
+        if (freeSlots < count)
+        {
+            cachedHead = head.load(memory_order_acquire);
+            freeSlots = buffer.size() - (t - cachedHead);
+        }
+
+        size_t n = count < freeSlots ? count : freeSlots;
+        for (size_t i = 0; i < n; ++i)
+        {
+            buffer[(t + i) & mask] = values[i];
+        }
+        tail.store(t + n, memory_order_release);
+        return n;
+    }
+
+    size_t pop_n(T* values, size_t count)
+    {
+        size_t h = head.load(memory_order_relaxed);
+        size_t available = cachedTail - h;
+        if (available < count)
+        {
+            cachedTail = tail.load(memory_order_acquire);
+            available = cachedTail - h;
+        }
+
+        size_t n = count < available ? count : available;
+        for (size_t i = 0; i < n; ++i)
+        {
+            values[i] = buffer[(h + i) & mask];
+        }
+        head.store(h + n, memory_order_release);
+        return n;
+    }
+};
+
+// === MPMC Ring Buffer (ticket scheme) ===
+
+template<typename T>
+class MpmcRingBuffer
+{
+private:
+    // Each slot carries a sequence number acting as its "ticket":
+    //   sequence == slot index        -> slot free, a producer may claim it
+    //   sequence == slot index + 1    -> slot filled, a consumer may claim it
+    struct Slot
+    {
+        atomic<size_t> sequence;
+        T value;
+    };
+
+    vector<Slot> slots;
+    size_t mask;
+
+    alignas(CACHE_LINE) atomic<size_t> enqueuePos{0};
+    alignas(CACHE_LINE) atomic<size_t> dequeuePos{0};
+
+public:
+    // capacity must be a power of two
+    MpmcRingBuffer(size_t capacity) : slots(capacity), mask(capacity - 1)
+    {
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            slots[i].sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    bool push(const T& value)
+    {
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = slots[pos & mask];
+            size_t seq = slot.sequence.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+            if (diff == 0)
+            {
+                // Slot free at our ticket: try to claim it
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                {
+                    slot.value = value;
+                    slot.sequence.store(pos + 1, memory_order_release);
+                    return true;
+                }
+                // CAS failed: pos was reloaded, retry
+            }
+            else if (diff < 0)
+            {
+                return false;                       // full
+            }
+            else
+            {
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(T& value)
+    {
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = slots[pos & mask];
+            size_t seq = slot.sequence.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+            if (diff == 0)
+            {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                {
+                    value = slot.value;
+                    // Recycle the slot for the producer one lap ahead
+                    slot.sequence.store(pos + slots.size(), memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;                       // empty
+            }
+            else
+            {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+    }
+};
+
+int main()
+{
+    cout << "=== Example 1: SPSC Hand-Off Between Two Threads ===" << endl;
+    {
+        SpscRingBuffer<int> ring(1024);
+        const int COUNT = 500000;
+        long long consumedSum = 0;
+
+        auto start = chrono::steady_clock::now();
+
+        thread producer([&]() {
+            for (int i = 1; i <= COUNT; ++i)
+            {
+                while (!ring.push(i)) { this_thread::yield(); }
+            }
+        });
+
+        thread consumer([&]() {
+            int value;
+            for (int i = 0; i < COUNT; )
+            {
+                if (ring.pop(value))
+                {
+                    consumedSum += value;
+                    i++;
+                }
+                else
+                {
+                    this_thread::yield();
+                }
+            }
+        });
+
+        producer.join();
+        consumer.join();
+
+        auto ms = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        long long expected = (long long)COUNT * (COUNT + 1) / 2;
+        cout << "Transferred " << COUNT << " messages in " << ms << " ms" << endl;
+        cout << "Sum check: " << (consumedSum == expected ? "OK" : "MISMATCH") << endl;
+        if (ms > 0)
+        {
+            cout << "Throughput: ~" << (COUNT / ms / 1000) << "M msgs/sec" << endl;
+        }
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Batch push_n/pop_n ===" << endl;
+    {
+        SpscRingBuffer<int> ring(1024);
+        const int COUNT = 500000;
+        const size_t BATCH = 64;
+        long long consumedSum = 0;
+
+        auto start = chrono::steady_clock::now();
+
+        thread producer([&]() {
+            int batch[BATCH];
+            int next = 1;
+            while (next <= COUNT)
+            {
+                size_t want = 0;
+                while (want < BATCH && next + (int)want <= COUNT)
+                {
+                    batch[want] = next + (int)want;
+                    want++;
+                }
+                size_t pushed = 0;
+                while (pushed < want)
+                {
+                    size_t n = ring.push_n(batch + pushed, want - pushed);
+                    if (n == 0) this_thread::yield();
+                    pushed += n;
+                }
+                next += (int)want;
+            }
+        });
+
+        thread consumer([&]() {
+            int batch[BATCH];
+            long long received = 0;
+            while (received < COUNT)
+            {
+                size_t got = ring.pop_n(batch, BATCH);
+                if (got == 0) this_thread::yield();
+                for (size_t i = 0; i < got; ++i)
+                {
+                    consumedSum += batch[i];
+                }
+                received += (long long)got;
+            }
+        });
+
+        producer.join();
+        consumer.join();
+
+        auto ms = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        long long expected = (long long)COUNT * (COUNT + 1) / 2;
+        cout << "Transferred " << COUNT << " messages in batches of " << BATCH
+             << " in " << ms << " ms" << endl;
+        cout << "Sum check: " << (consumedSum == expected ? "OK" : "MISMATCH") << endl;
+        cout << "One atomic store publishes " << BATCH << " slots at once" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: MPMC with Ticketed Slots ===" << endl;
+    {
+        MpmcRingBuffer<int> ring(1024);
+        const int PER_PRODUCER = 100000;
+        const int PRODUCERS = 2;
+        const int CONSUMERS = 2;
+        atomic<long long> consumedSum{0};
+        atomic<int> consumedCount{0};
+
+        vector<thread> threads;
+        for (int p = 0; p < PRODUCERS; ++p)
+        {
+            threads.emplace_back([&, p]() {
+                for (int i = 0; i < PER_PRODUCER; ++i)
+                {
+                    while (!ring.push(p * PER_PRODUCER + i + 1)) { this_thread::yield(); }
+                }
+            });
+        }
+        for (int c = 0; c < CONSUMERS; ++c)
+        {
+            threads.emplace_back([&]() {
+                int value;
+                while (consumedCount.load() < PRODUCERS * PER_PRODUCER)
+                {
+                    if (ring.pop(value))
+                    {
+                        consumedSum += value;
+                        consumedCount++;
+                    }
+                    else
+                    {
+                        this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        long long total = (long long)PRODUCERS * PER_PRODUCER;
+        long long expected = total * (total + 1) / 2;
+        cout << PRODUCERS << " producers, " << CONSUMERS << " consumers, "
+             << total << " messages" << endl;
+        cout << "Sum check: " << (consumedSum == expected ? "OK" : "MISMATCH") << endl;
+        cout << "Each slot's sequence number acts as a ticket — no locks" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. SPSC: one relaxed load + one release store per operation" << endl;
+    cout << "2. Cached indices: the other side's atomic is re-read only" << endl;
+    cout << "   when the ring looks full/empty" << endl;
+    cout << "3. Padding: head and tail never share a cache line" << endl;
+    cout << "4. MPMC tickets: per-slot sequence numbers order claims" << endl;
+    cout << "5. Batching: push_n/pop_n amortize the atomic over a burst" << endl;
+
+    return 0;
+}
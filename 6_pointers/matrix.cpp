@@ -0,0 +1,269 @@
+/*
+### Contiguous, Cache-Blocked Matrix
+
+pointer_arrays.cpp demonstrates int matrix[3][4] with row pointers and
+pointer_to_pointer.cpp builds matrices as pointer-to-pointer rows.
+That layout gives every row its own allocation: no locality across
+rows, a pointer dereference per row access, and n+1 mallocs per
+matrix.
+
+This file adds the production layout:
+1. Matrix<T>: ONE contiguous allocation, element (r,c) at r*cols + c
+2. Cache-blocked multiply(): operates on square tiles that fit in L1,
+   so each loaded cache line is reused many times before eviction
+3. Blocked transpose() for the same reason
+4. view(): zero-copy sub-matrix slicing via (pointer, stride) — no
+   data moves, writes through the view hit the parent
+
+
+### Why does the naive triple loop thrash?
+- C = A * B reads B column-wise; in row-major order each B access
+  in the inner loop lands on a different cache line
+- Tiling keeps a block of A, B, and C resident while all the work
+  that touches them happens
+
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+
+using namespace std;
+
+// === Zero-copy view into a matrix ===
+
+template<typename T>
+class MatrixView
+{
+private:
+    T* base;            // first element of the view
+    size_t viewRows, viewCols;
+    size_t stride;      // parent's column count
+
+public:
+    MatrixView(T* b, size_t r, size_t c, size_t s)
+        : base(b), viewRows(r), viewCols(c), stride(s) {}
+
+    T& at(size_t r, size_t c) { return base[r * stride + c]; }
+    const T& at(size_t r, size_t c) const { return base[r * stride + c]; }
+
+    size_t rows() const { return viewRows; }
+    size_t cols() const { return viewCols; }
+};
+
+// === Contiguous matrix ===
+
+template<typename T>
+class Matrix
+{
+private:
+    vector<T> data;     // one allocation, row-major
+    size_t rowCount, colCount;
+
+    static constexpr size_t TILE = 64;  // 64x64 ints = 16KB, fits L1
+
+public:
+    Matrix(size_t rows, size_t cols)
+        : data(rows * cols, T{}), rowCount(rows), colCount(cols) {}
+
+    T& at(size_t r, size_t c) { return data[r * colCount + c]; }
+    const T& at(size_t r, size_t c) const { return data[r * colCount + c]; }
+
+    size_t rows() const { return rowCount; }
+    size_t cols() const { return colCount; }
+
+    // Zero-copy slice: shares storage with this matrix
+    MatrixView<T> view(size_t r0, size_t c0, size_t rows, size_t cols)
+    {
+        return MatrixView<T>(&data[r0 * colCount + c0], rows, cols, colCount);
+    }
+
+    // The textbook triple loop: correct, cache-hostile on B
+    Matrix multiplyNaive(const Matrix& other) const
+    {
+        Matrix result(rowCount, other.colCount);
+        for (size_t i = 0; i < rowCount; ++i)
+        {
+            for (size_t j = 0; j < other.colCount; ++j)
+            {
+                T sum = T{};
+                for (size_t k = 0; k < colCount; ++k)
+                {
+                    sum += at(i, k) * other.at(k, j);
+                }
+                result.at(i, j) = sum;
+            }
+        }
+        return result;
+    }
+
+    // Cache-blocked: process TILE x TILE sub-problems so the working
+    // set stays in L1; inner loop walks both C and B row-wise
+    Matrix multiply(const Matrix& other) const
+    {
+        Matrix result(rowCount, other.colCount);
+
+        for (size_t i0 = 0; i0 < rowCount; i0 += TILE)
+        {
+            for (size_t k0 = 0; k0 < colCount; k0 += TILE)
+            {
+                for (size_t j0 = 0; j0 < other.colCount; j0 += TILE)
+                {
+                    size_t iMax = min(i0 + TILE, rowCount);
+                    size_t kMax = min(k0 + TILE, colCount);
+                    size_t jMax = min(j0 + TILE, other.colCount);
+
+                    for (size_t i = i0; i < iMax; ++i)
+                    {
+                        for (size_t k = k0; k < kMax; ++k)
+                        {
+                            T aik = at(i, k);
+                            const T* bRow = &other.data[k * other.colCount];
+                            T* cRow = &result.data[i * other.colCount];
+                            for (size_t j = j0; j < jMax; ++j)
+                            {
+                                cRow[j] += aik * bRow[j];   // unit stride
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    // Blocked transpose: read a tile row-wise, write it column-wise,
+    // both within cache
+    Matrix transpose() const
+    {
+        Matrix result(colCount, rowCount);
+        for (size_t i0 = 0; i0 < rowCount; i0 += TILE)
+        {
+            for (size_t j0 = 0; j0 < colCount; j0 += TILE)
+            {
+                size_t iMax = min(i0 + TILE, rowCount);
+                size_t jMax = min(j0 + TILE, colCount);
+                for (size_t i = i0; i < iMax; ++i)
+                {
+                    for (size_t j = j0; j < jMax; ++j)
+                    {
+                        result.at(j, i) = at(i, j);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    bool operator==(const Matrix& other) const
+    {
+        return rowCount == other.rowCount && colCount == other.colCount &&
+               data == other.data;
+    }
+};
+
+int main()
+{
+    cout << "=== Example 1: One Allocation, Row-Major Access ===" << endl;
+    {
+        Matrix<int> m(3, 4);
+        for (size_t r = 0; r < m.rows(); ++r)
+        {
+            for (size_t c = 0; c < m.cols(); ++c)
+            {
+                m.at(r, c) = (int)(r * 10 + c);
+            }
+        }
+
+        cout << "3x4 matrix (single contiguous block):" << endl;
+        for (size_t r = 0; r < m.rows(); ++r)
+        {
+            cout << "  ";
+            for (size_t c = 0; c < m.cols(); ++c)
+            {
+                cout << m.at(r, c) << "\t";
+            }
+            cout << endl;
+        }
+        cout << "vs pointer-to-pointer: " << (m.rows() + 1)
+             << " allocations become 1" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Zero-Copy Sub-Matrix View ===" << endl;
+    {
+        Matrix<int> m(4, 4);
+        for (size_t r = 0; r < 4; ++r)
+            for (size_t c = 0; c < 4; ++c)
+                m.at(r, c) = (int)(r * 4 + c);
+
+        auto inner = m.view(1, 1, 2, 2);
+        cout << "2x2 view at (1,1): " << inner.at(0, 0) << " " << inner.at(0, 1)
+             << " / " << inner.at(1, 0) << " " << inner.at(1, 1) << endl;
+
+        inner.at(0, 0) = 99;
+        cout << "Writing 99 through the view: parent (1,1) = "
+             << m.at(1, 1) << " (shared storage)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Naive vs Cache-Blocked Multiply ===" << endl;
+    {
+        const size_t N = 512;
+        Matrix<int> a(N, N), b(N, N);
+        for (size_t r = 0; r < N; ++r)
+        {
+            for (size_t c = 0; c < N; ++c)
+            {
+                a.at(r, c) = (int)((r + c) % 7);
+                b.at(r, c) = (int)((r * 3 + c) % 5);
+            }
+        }
+
+        auto start = chrono::steady_clock::now();
+        Matrix<int> naive = a.multiplyNaive(b);
+        auto naiveMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        Matrix<int> tiled = a.multiply(b);
+        auto tiledMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << N << "x" << N << " multiply:" << endl;
+        cout << "  naive triple loop: " << naiveMs << " ms" << endl;
+        cout << "  cache-blocked:     " << tiledMs << " ms" << endl;
+        cout << "Results match: " << (naive == tiled ? "OK" : "MISMATCH") << endl;
+        cout << "(the gap widens with matrix size: at 2048x2048 the naive" << endl;
+        cout << " loop misses cache on nearly every B access)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 4: Blocked Transpose ===" << endl;
+    {
+        const size_t N = 2048;
+        Matrix<int> m(N, N);
+        for (size_t r = 0; r < N; ++r)
+            for (size_t c = 0; c < N; ++c)
+                m.at(r, c) = (int)(r * N + c);
+
+        auto start = chrono::steady_clock::now();
+        Matrix<int> t = m.transpose();
+        auto ms = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << N << "x" << N << " blocked transpose: " << ms << " ms" << endl;
+        cout << "Check: t(5, 9) == m(9, 5): "
+             << (t.at(5, 9) == m.at(9, 5) ? "OK" : "MISMATCH") << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Contiguous storage: locality across rows, 1 allocation" << endl;
+    cout << "2. Tiled multiply: every loaded line reused TILE times" << endl;
+    cout << "3. Inner loop is unit-stride on B and C (vectorizable)" << endl;
+    cout << "4. view(): (pointer, stride) slicing, zero copies" << endl;
+
+    return 0;
+}
@@ -33,8 +33,9 @@ This file contains real-world examples demonstrating practical uses of pointers:
 
 
 ### Example 5: Dynamic Array Resize
-- Grow array when capacity reached
-- Copy old data to new location
+- Small-buffer optimization: first elements live inline, no heap touch
+- Pluggable growth policy (1.5x, 2x, or exact)
+- memcpy-based relocation for trivially copyable types
 
 
 ### Example 6: Multiple Return Values
@@ -56,6 +57,9 @@ This file contains real-world examples demonstrating practical uses of pointers:
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <type_traits>
+#include <utility>
+#include <new>
 
 using namespace std;
 
@@ -150,51 +154,131 @@ void freeList(Node** head)
 }
 
 // === Example 5: Dynamic Array Resize ===
+
+// How capacity grows when the array is full
+enum class GrowthPolicy
+{
+    Double,         // 2x: fewest reallocations
+    OneAndHalf,     // 1.5x: less memory waste, allows block reuse
+    Exact           // +1: minimal memory, O(n^2) appends — for fixed workloads
+};
+
+template<typename T, int InlineCapacity = 16>
 class DynamicArray
 {
 private:
-    int* data;
+    // Small-buffer optimization: the first InlineCapacity elements live
+    // inside the object itself, so short-lived arrays never touch the heap
+    alignas(T) unsigned char inlineStorage[InlineCapacity * sizeof(T)];
+    T* data;
     int size;
     int capacity;
+    GrowthPolicy policy;
+
+    T* inlineBuffer() { return reinterpret_cast<T*>(inlineStorage); }
+
+    int grownCapacity() const
+    {
+        switch (policy)
+        {
+            case GrowthPolicy::Double:     return capacity * 2;
+            case GrowthPolicy::OneAndHalf: return capacity + capacity / 2 + 1;
+            case GrowthPolicy::Exact:      return capacity + 1;
+        }
+        return capacity * 2;
+    }
+
+    // Move elements into a fresh buffer: one memcpy for trivially
+    // copyable types, element-wise move otherwise
+    void relocate(T* dest, int newCapacity)
+    {
+        if constexpr (is_trivially_copyable_v<T>)
+        {
+            memcpy(dest, data, size * sizeof(T));
+        }
+        else
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                new (dest + i) T(std::move(data[i]));
+                data[i].~T();
+            }
+        }
+
+        if (!isInline())
+        {
+            operator delete(data);
+        }
+        data = dest;
+        capacity = newCapacity;
+    }
 
 public:
-    DynamicArray()
+    DynamicArray(GrowthPolicy p = GrowthPolicy::Double)
+        : data(inlineBuffer()), size(0), capacity(InlineCapacity), policy(p)
     {
-        capacity = 2;
-        size = 0;
-        data = new int[capacity];
     }
 
     ~DynamicArray()
     {
-        delete[] data;
+        for (int i = 0; i < size; ++i)
+        {
+            data[i].~T();
+        }
+        if (!isInline())
+        {
+            operator delete(data);
+        }
     }
 
-    void push(int value)
+    // Move construction: steal the heap buffer, or memcpy the inline one
+    DynamicArray(DynamicArray&& other)
+        : data(inlineBuffer()), size(other.size), capacity(other.capacity),
+          policy(other.policy)
     {
-        if (size == capacity)
+        if (other.isInline())
         {
-            // Resize: double capacity
-            capacity *= 2;
-            int* newData = new int[capacity];
-
-            // Copy old data
             for (int i = 0; i < size; ++i)
             {
-                newData[i] = data[i];
+                new (data + i) T(std::move(other.data[i]));
+                other.data[i].~T();
             }
-
-            delete[] data;
-            data = newData;
         }
+        else
+        {
+            data = other.data;
+        }
+        other.data = other.inlineBuffer();
+        other.size = 0;
+        other.capacity = InlineCapacity;
+    }
+
+    DynamicArray(const DynamicArray&) = delete;
+    DynamicArray& operator=(const DynamicArray&) = delete;
 
-        data[size++] = value;
+    void reserve(int newCapacity)
+    {
+        if (newCapacity <= capacity) return;
+
+        T* newData = static_cast<T*>(operator new(newCapacity * sizeof(T)));
+        relocate(newData, newCapacity);
+    }
+
+    void push(const T& value)
+    {
+        if (size == capacity)
+        {
+            reserve(grownCapacity());
+        }
+        new (data + size) T(value);
+        size++;
     }
 
     int getSize() const { return size; }
     int getCapacity() const { return capacity; }
+    bool isInline() const { return data == reinterpret_cast<const T*>(inlineStorage); }
 
-    int& operator[](int index)
+    T& operator[](int index)
     {
         return data[index];
     }
@@ -333,18 +417,29 @@ int main()
     cout << "List memory freed" << endl;
     cout << endl;
 
-    cout << "=== Example 5: Dynamic Array with Auto-Resize ===" << endl;
-    DynamicArray dynArr;
+    cout << "=== Example 5: Dynamic Array with SBO and Auto-Resize ===" << endl;
+    DynamicArray<int> dynArr;
 
-    cout << "Initial capacity: " << dynArr.getCapacity() << endl;
+    cout << "Inline capacity: " << dynArr.getCapacity()
+         << " (no heap allocation yet)" << endl;
     cout << "Pushing elements: 1, 2, 3, 4, 5" << endl;
 
     for (int i = 1; i <= 5; ++i)
     {
         dynArr.push(i);
-        cout << "  After push(" << i << "): size = " << dynArr.getSize() 
-             << ", capacity = " << dynArr.getCapacity() << endl;
     }
+    cout << "  size = " << dynArr.getSize()
+         << ", capacity = " << dynArr.getCapacity()
+         << ", inline = " << (dynArr.isInline() ? "yes" : "no") << endl;
+
+    cout << "Pushing up to 20 elements (spills past inline capacity)..." << endl;
+    for (int i = 6; i <= 20; ++i)
+    {
+        dynArr.push(i);
+    }
+    cout << "  size = " << dynArr.getSize()
+         << ", capacity = " << dynArr.getCapacity()
+         << ", inline = " << (dynArr.isInline() ? "yes" : "no") << endl;
 
     cout << "Array contents: ";
     for (int i = 0; i < dynArr.getSize(); ++i)
@@ -352,7 +447,43 @@ int main()
         cout << dynArr[i] << " ";
     }
     cout << endl;
-    cout << "Automatically resizes by allocating new memory and copying" << endl;
+
+    cout << "Growth policy comparison (pushing 100 elements):" << endl;
+    {
+        DynamicArray<int> byDouble(GrowthPolicy::Double);
+        DynamicArray<int> byHalf(GrowthPolicy::OneAndHalf);
+        for (int i = 0; i < 100; ++i)
+        {
+            byDouble.push(i);
+            byHalf.push(i);
+        }
+        cout << "  Double:     capacity = " << byDouble.getCapacity() << endl;
+        cout << "  OneAndHalf: capacity = " << byHalf.getCapacity() << endl;
+    }
+
+    cout << "reserve() avoids repeated growth:" << endl;
+    {
+        DynamicArray<int> reserved;
+        reserved.reserve(1000);
+        for (int i = 0; i < 1000; ++i)
+        {
+            reserved.push(i);
+        }
+        cout << "  1000 pushes, one allocation, capacity = "
+             << reserved.getCapacity() << endl;
+    }
+
+    cout << "Move construction steals the heap buffer:" << endl;
+    {
+        DynamicArray<int> source;
+        source.reserve(100);
+        for (int i = 0; i < 50; ++i) source.push(i);
+
+        DynamicArray<int> stolen(std::move(source));
+        cout << "  moved-to size = " << stolen.getSize()
+             << ", moved-from size = " << source.getSize() << endl;
+    }
+    cout << "Small arrays stay inline; trivially copyable types relocate via memcpy" << endl;
     cout << endl;
 
     cout << "=== Example 6: Multiple Return Values ===" << endl;
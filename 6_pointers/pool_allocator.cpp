@@ -0,0 +1,448 @@
+/*
+### Size-Class Pool Allocator
+
+pointer_dynamic_memory.cpp teaches the raw new/delete lifecycle. At
+scale that pattern has two costs the examples never show: every
+allocation crosses into the general-purpose heap (a locked, shared
+structure), and freeing objects of mixed sizes fragments it — the
+process keeps growing even though live bytes do not.
+
+This file adds the standard fix, a hierarchical free-list allocator:
+1. Sizes are rounded up to a small set of CLASSES (16..1024 bytes);
+   every block in a class is interchangeable, so there is nothing to
+   fragment
+2. Each thread keeps a THREAD-LOCAL free list per class — the hot
+   path (pop/push a pointer) touches no locks at all
+3. A central store backs the thread caches: refills move BATCHES of
+   64 blocks under one lock acquisition, and carve new 64KB slabs
+   when the central list runs dry
+4. Pool::AllocStats reports live/peak counts per size class — the
+   number you need when chasing RSS growth
+5. PoolNew<T>()/PoolDelete() are drop-in replacements for new/delete
+   for the Node/TreeNode-style objects in the pointer examples
+
+Requests larger than 1KB fall through to plain new — size classes
+only pay off for the small objects that dominate allocation counts.
+
+*/
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+using namespace std;
+
+namespace Pool
+{
+    // 16, 32, 64, 128, 256, 512, 1024
+    constexpr size_t CLASS_COUNT = 7;
+    constexpr size_t MAX_POOLED_SIZE = 1024;
+    constexpr size_t SLAB_SIZE = 64 * 1024;
+    constexpr size_t REFILL_BATCH = 64;
+
+    constexpr size_t classSize(size_t classIndex)
+    {
+        return (size_t)16 << classIndex;
+    }
+
+    inline size_t classForSize(size_t bytes)
+    {
+        size_t index = 0;
+        while (classSize(index) < bytes)
+        {
+            ++index;
+        }
+        return index;
+    }
+
+    // === Statistics ===
+
+    struct ClassStats
+    {
+        atomic<long long> live{0};
+        atomic<long long> peak{0};
+
+        void onAlloc()
+        {
+            long long now = live.fetch_add(1, memory_order_relaxed) + 1;
+            long long seen = peak.load(memory_order_relaxed);
+            while (now > seen &&
+                   !peak.compare_exchange_weak(seen, now, memory_order_relaxed))
+            {
+            }
+        }
+
+        void onFree() { live.fetch_sub(1, memory_order_relaxed); }
+    };
+
+    struct AllocStats
+    {
+        ClassStats classes[CLASS_COUNT];
+        ClassStats oversized;               // fell through to plain new
+
+        void print() const
+        {
+            cout << "  size class   live   peak" << endl;
+            for (size_t i = 0; i < CLASS_COUNT; ++i)
+            {
+                cout << "  " << classSize(i) << "B\t       "
+                     << classes[i].live.load() << "      "
+                     << classes[i].peak.load() << endl;
+            }
+            cout << "  >1KB\t       " << oversized.live.load()
+                 << "      " << oversized.peak.load() << endl;
+        }
+    };
+
+    inline AllocStats& stats()
+    {
+        static AllocStats s;
+        return s;
+    }
+
+    // === Central store: slabs + per-class free lists, one lock each ===
+
+    class CentralStore
+    {
+    private:
+        struct CentralClass
+        {
+            mutex guard;
+            vector<void*> freeBlocks;
+            vector<unique_ptr<char[]>> slabs;
+        };
+
+        CentralClass classes[CLASS_COUNT];
+
+        // Carve one slab into blocks of this class's size
+        void addSlab(size_t classIndex)
+        {
+            CentralClass& c = classes[classIndex];
+            size_t blockSize = classSize(classIndex);
+            c.slabs.push_back(make_unique<char[]>(SLAB_SIZE));
+            char* base = c.slabs.back().get();
+            for (size_t offset = 0; offset + blockSize <= SLAB_SIZE; offset += blockSize)
+            {
+                c.freeBlocks.push_back(base + offset);
+            }
+        }
+
+    public:
+        // Move up to REFILL_BATCH blocks into `out` under one lock
+        void refill(size_t classIndex, vector<void*>& out)
+        {
+            CentralClass& c = classes[classIndex];
+            lock_guard<mutex> lock(c.guard);
+            if (c.freeBlocks.size() < REFILL_BATCH)
+            {
+                addSlab(classIndex);
+            }
+            for (size_t i = 0; i < REFILL_BATCH && !c.freeBlocks.empty(); ++i)
+            {
+                out.push_back(c.freeBlocks.back());
+                c.freeBlocks.pop_back();
+            }
+        }
+
+        // Take a batch back from an overfull thread cache
+        void release(size_t classIndex, vector<void*>& blocks, size_t count)
+        {
+            CentralClass& c = classes[classIndex];
+            lock_guard<mutex> lock(c.guard);
+            for (size_t i = 0; i < count; ++i)
+            {
+                c.freeBlocks.push_back(blocks.back());
+                blocks.pop_back();
+            }
+        }
+    };
+
+    inline CentralStore& central()
+    {
+        static CentralStore store;
+        return store;
+    }
+
+    // === Thread cache: the lock-free hot path ===
+
+    class ThreadCache
+    {
+    private:
+        // Return half to the central store when a list grows past this
+        static constexpr size_t OVERFULL = 2 * REFILL_BATCH;
+
+        vector<void*> freeLists[CLASS_COUNT];
+
+    public:
+        void* allocate(size_t classIndex)
+        {
+            vector<void*>& list = freeLists[classIndex];
+            if (list.empty())
+            {
+                central().refill(classIndex, list);
+            }
+            void* block = list.back();
+            list.pop_back();
+            return block;
+        }
+
+        void deallocate(size_t classIndex, void* block)
+        {
+            vector<void*>& list = freeLists[classIndex];
+            list.push_back(block);
+            if (list.size() > OVERFULL)
+            {
+                central().release(classIndex, list, REFILL_BATCH);
+            }
+        }
+
+        ~ThreadCache()
+        {
+            // Thread exit: hand everything back
+            for (size_t i = 0; i < CLASS_COUNT; ++i)
+            {
+                central().release(i, freeLists[i], freeLists[i].size());
+            }
+        }
+    };
+
+    inline ThreadCache& threadCache()
+    {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+
+    // === Raw interface ===
+
+    inline void* allocate(size_t bytes)
+    {
+        if (bytes > MAX_POOLED_SIZE)
+        {
+            stats().oversized.onAlloc();
+            return ::operator new(bytes);
+        }
+        size_t classIndex = classForSize(bytes);
+        stats().classes[classIndex].onAlloc();
+        return threadCache().allocate(classIndex);
+    }
+
+    inline void deallocate(void* block, size_t bytes)
+    {
+        if (bytes > MAX_POOLED_SIZE)
+        {
+            stats().oversized.onFree();
+            ::operator delete(block);
+            return;
+        }
+        size_t classIndex = classForSize(bytes);
+        stats().classes[classIndex].onFree();
+        threadCache().deallocate(classIndex, block);
+    }
+}
+
+// === Drop-in replacements for new/delete ===
+
+template<typename T, typename... Args>
+T* PoolNew(Args&&... args)
+{
+    void* memory = Pool::allocate(sizeof(T));
+    return new (memory) T(std::forward<Args>(args)...);
+}
+
+template<typename T>
+void PoolDelete(T* object)
+{
+    if (object == nullptr) return;
+    object->~T();
+    Pool::deallocate(object, sizeof(T));
+}
+
+// === The small objects the pointer examples allocate ===
+
+struct Node
+{
+    int data;
+    Node* next;
+    Node(int d) : data(d), next(nullptr) {}
+};
+
+struct TreeNode
+{
+    int value;
+    TreeNode* left;
+    TreeNode* right;
+    TreeNode(int v) : value(v), left(nullptr), right(nullptr) {}
+};
+
+static TreeNode* buildTree(int depth, int& counter)
+{
+    if (depth == 0) return nullptr;
+    TreeNode* node = PoolNew<TreeNode>(counter++);
+    node->left = buildTree(depth - 1, counter);
+    node->right = buildTree(depth - 1, counter);
+    return node;
+}
+
+static void destroyTree(TreeNode* node)
+{
+    if (node == nullptr) return;
+    destroyTree(node->left);
+    destroyTree(node->right);
+    PoolDelete(node);
+}
+
+int main()
+{
+    cout << "=== Example 1: PoolNew/PoolDelete as Drop-In new/delete ===" << endl;
+    {
+        // The classic linked-list churn from the pointer examples
+        Node* head = nullptr;
+        for (int i = 0; i < 5; ++i)
+        {
+            Node* node = PoolNew<Node>(i * 10);
+            node->next = head;
+            head = node;
+        }
+
+        cout << "Pooled list: ";
+        for (Node* n = head; n != nullptr; n = n->next)
+        {
+            cout << n->data << " ";
+        }
+        cout << endl;
+
+        while (head != nullptr)
+        {
+            Node* next = head->next;
+            PoolDelete(head);
+            head = next;
+        }
+        cout << "Freed: blocks went back to the 16B free list, not the heap" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Tree Build/Destroy Cycles ===" << endl;
+    {
+        // Build and tear down repeatedly — with raw new/delete this is
+        // exactly the churn that fragments a general-purpose heap
+        for (int cycle = 0; cycle < 3; ++cycle)
+        {
+            int counter = 0;
+            TreeNode* root = buildTree(10, counter);
+            destroyTree(root);
+        }
+        cout << "3 cycles of a 1023-node tree: every cycle reuses the" << endl;
+        cout << "same blocks, so the footprint stays flat" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Throughput vs new/delete ===" << endl;
+    {
+        // 1000 live nodes at a time so the allocations can't be
+        // elided, freed in a different order than allocated — the
+        // pattern that hurts a general-purpose heap
+        const int ROUNDS = 1000;
+        const int BATCH = 1000;
+        vector<Node*> batch(BATCH);
+        long long heapSum = 0, poolSum = 0;
+
+        auto start = chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; ++r)
+        {
+            for (int i = 0; i < BATCH; ++i)
+            {
+                batch[i] = new Node(i);
+            }
+            for (int i = BATCH - 1; i >= 0; --i)
+            {
+                heapSum += batch[i]->data;
+                delete batch[i];
+            }
+        }
+        auto heapMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; ++r)
+        {
+            for (int i = 0; i < BATCH; ++i)
+            {
+                batch[i] = PoolNew<Node>(i);
+            }
+            for (int i = BATCH - 1; i >= 0; --i)
+            {
+                poolSum += batch[i]->data;
+                PoolDelete(batch[i]);
+            }
+        }
+        auto poolMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << ROUNDS * BATCH << " alloc/free pairs (1000 live at a time):" << endl;
+        cout << "  new/delete:          " << heapMs << " ms" << endl;
+        cout << "  PoolNew/PoolDelete:  " << poolMs << " ms" << endl;
+        cout << "Checksums match: " << (heapSum == poolSum ? "OK" : "MISMATCH") << endl;
+        cout << "(modern mallocs also thread-cache small blocks, so raw speed" << endl;
+        cout << " can tie; the pool's win is zero fragmentation, flat RSS, and" << endl;
+        cout << " the per-class stats below)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 4: Thread-Local Caches Under Contention ===" << endl;
+    {
+        // Two threads churning the same size class: each works out of
+        // its own cache; the central lock is only taken per 64-block
+        // batch, not per allocation
+        auto churn = []() {
+            for (int i = 0; i < 200000; ++i)
+            {
+                Node* n = PoolNew<Node>(i);
+                PoolDelete(n);
+            }
+        };
+
+        thread a(churn), b(churn);
+        a.join();
+        b.join();
+        cout << "2 threads x 200000 alloc/free pairs completed" << endl;
+        cout << "Central lock acquisitions: ~1 per " << Pool::REFILL_BATCH
+             << " blocks moved, not per operation" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 5: AllocStats ===" << endl;
+    {
+        vector<TreeNode*> liveNodes;
+        for (int i = 0; i < 100; ++i)
+        {
+            liveNodes.push_back(PoolNew<TreeNode>(i));
+        }
+
+        cout << "With 100 TreeNodes live:" << endl;
+        Pool::stats().print();
+
+        for (TreeNode* n : liveNodes)
+        {
+            PoolDelete(n);
+        }
+        cout << endl << "After freeing them (live drops, peak stays):" << endl;
+        Pool::stats().print();
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Size classes: interchangeable blocks, nothing fragments" << endl;
+    cout << "2. Thread-local free lists: the hot path takes no locks" << endl;
+    cout << "3. Central store moves 64-block batches per lock acquisition" << endl;
+    cout << "4. AllocStats live/peak per class: the RSS-growth debugging view" << endl;
+    cout << "5. PoolNew/PoolDelete: drop-in for the Node/TreeNode examples" << endl;
+
+    return 0;
+}
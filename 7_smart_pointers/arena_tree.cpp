@@ -0,0 +1,242 @@
+/*
+### Arena Allocator for Tree Hierarchies
+
+The TreeNode in smart_pointer_examples.cpp allocates every node with
+make_unique and tears the tree down with a recursive pointer-chasing
+walk. For large trees (millions of nodes) most of the build time goes
+to the allocator and most of the teardown to destructor chains.
+
+This file demonstrates the arena alternative:
+1. Nodes are bump-allocated from large contiguous blocks
+2. Parent/child links are plain pointers into the arena
+3. Teardown is freeing a handful of blocks — no per-node walk
+4. The addChild()/print() API shape is unchanged from TreeNode
+
+
+### Why is bump allocation fast?
+- Allocating = advancing one offset pointer (a few instructions)
+- No free lists, no locks, no per-allocation bookkeeping
+- Nodes built together sit together in memory (cache locality)
+
+
+### The trade-off
+- Individual nodes cannot be freed — the whole arena dies at once
+- That matches tree lifetimes exactly: a config tree is built, read,
+  and discarded as a unit
+
+*/
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+
+using namespace std;
+
+// === Bump Arena ===
+
+class Arena
+{
+private:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    struct Block
+    {
+        unique_ptr<unsigned char[]> memory;
+        size_t used = 0;
+    };
+
+    vector<Block> blocks;
+    size_t totalAllocated = 0;
+
+    Block& currentBlock(size_t needed)
+    {
+        if (blocks.empty() || blocks.back().used + needed > BLOCK_SIZE)
+        {
+            blocks.push_back(Block{make_unique<unsigned char[]>(BLOCK_SIZE), 0});
+        }
+        return blocks.back();
+    }
+
+public:
+    void* allocate(size_t bytes, size_t alignment)
+    {
+        // Round the offset up to the requested alignment
+        Block& block = currentBlock(bytes + alignment);
+        size_t offset = (block.used + alignment - 1) & ~(alignment - 1);
+
+        void* ptr = block.memory.get() + offset;
+        block.used = offset + bytes;
+        totalAllocated += bytes;
+        return ptr;
+    }
+
+    template<typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        void* memory = allocate(sizeof(T), alignof(T));
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    size_t blockCount() const { return blocks.size(); }
+    size_t bytesAllocated() const { return totalAllocated; }
+
+    // Teardown: the vector of blocks is freed; no node is visited.
+    // Note: node destructors do NOT run — arena nodes must hold only
+    // trivially destructible members or arena-owned data.
+};
+
+// === Arena-Backed Tree Node ===
+
+// Same API shape as TreeNode (addChild / print / getData / childCount),
+// but nodes live in the arena and links are raw pointers into it.
+class ArenaTreeNode
+{
+private:
+    const char* data;                   // points into the arena
+    ArenaTreeNode* firstChild = nullptr;
+    ArenaTreeNode* nextSibling = nullptr;
+    ArenaTreeNode* parent = nullptr;
+    Arena* arena;
+
+public:
+    ArenaTreeNode(Arena& a, const string& d) : arena(&a)
+    {
+        // Copy the label into the arena so the node owns no heap memory
+        char* copy = static_cast<char*>(arena->allocate(d.size() + 1, 1));
+        d.copy(copy, d.size());
+        copy[d.size()] = '\0';
+        data = copy;
+    }
+
+    ArenaTreeNode* addChild(const string& childData)
+    {
+        ArenaTreeNode* child = arena->create<ArenaTreeNode>(*arena, childData);
+        child->parent = this;
+        child->nextSibling = firstChild;
+        firstChild = child;
+        return child;
+    }
+
+    void print(int indent = 0) const
+    {
+        for (int i = 0; i < indent; ++i) cout << "  ";
+        cout << data << endl;
+
+        for (const ArenaTreeNode* child = firstChild; child; child = child->nextSibling)
+        {
+            child->print(indent + 1);
+        }
+    }
+
+    string getData() const { return data; }
+
+    size_t childCount() const
+    {
+        size_t count = 0;
+        for (const ArenaTreeNode* child = firstChild; child; child = child->nextSibling)
+        {
+            count++;
+        }
+        return count;
+    }
+
+    ArenaTreeNode* getParent() const { return parent; }
+};
+
+// === Reference: the smart-pointer tree from smart_pointer_examples.cpp ===
+
+class HeapTreeNode
+{
+private:
+    string data;
+    vector<unique_ptr<HeapTreeNode>> children;
+
+public:
+    HeapTreeNode(string d) : data(std::move(d)) {}
+
+    HeapTreeNode* addChild(const string& childData)
+    {
+        children.push_back(make_unique<HeapTreeNode>(childData));
+        return children.back().get();
+    }
+};
+
+int main()
+{
+    cout << "=== Example 1: Building a Tree in an Arena ===" << endl;
+    {
+        Arena arena;
+        ArenaTreeNode* root = arena.create<ArenaTreeNode>(arena, "Root");
+
+        ArenaTreeNode* child1 = root->addChild("Child1");
+        root->addChild("Child2");
+        child1->addChild("Grandchild1");
+        child1->addChild("Grandchild2");
+
+        cout << "Tree structure:" << endl;
+        root->print();
+
+        cout << "\nArena blocks: " << arena.blockCount()
+             << ", bytes used: " << arena.bytesAllocated() << endl;
+        cout << "Parent of Grandchild via raw link: "
+             << child1->getData() << endl;
+    }
+    cout << "Arena destroyed: one vector free, zero per-node destructors" << endl;
+    cout << endl;
+
+    cout << "=== Example 2: Build and Teardown Cost vs make_unique ===" << endl;
+    {
+        const int CHILDREN = 100;
+        const int GRANDCHILDREN = 1000;
+
+        // Heap tree: one allocation per node, recursive teardown
+        auto heapStart = chrono::steady_clock::now();
+        {
+            auto root = make_unique<HeapTreeNode>("Root");
+            for (int i = 0; i < CHILDREN; ++i)
+            {
+                HeapTreeNode* child = root->addChild("child");
+                for (int j = 0; j < GRANDCHILDREN; ++j)
+                {
+                    child->addChild("grandchild");
+                }
+            }
+        }
+        auto heapUs = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - heapStart).count();
+
+        // Arena tree: bump allocation, block-level teardown
+        auto arenaStart = chrono::steady_clock::now();
+        {
+            Arena arena;
+            ArenaTreeNode* root = arena.create<ArenaTreeNode>(arena, "Root");
+            for (int i = 0; i < CHILDREN; ++i)
+            {
+                ArenaTreeNode* child = root->addChild("child");
+                for (int j = 0; j < GRANDCHILDREN; ++j)
+                {
+                    child->addChild("grandchild");
+                }
+            }
+        }
+        auto arenaUs = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - arenaStart).count();
+
+        int nodes = 1 + CHILDREN + CHILDREN * GRANDCHILDREN;
+        cout << "Nodes per tree: " << nodes << endl;
+        cout << "make_unique tree (build + teardown): " << heapUs << " us" << endl;
+        cout << "Arena tree (build + teardown):       " << arenaUs << " us" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Bump allocation: one offset increment per node" << endl;
+    cout << "2. 64KB blocks: few mallocs, nodes packed contiguously" << endl;
+    cout << "3. Sibling-chained children: no per-node vector allocations" << endl;
+    cout << "4. Teardown frees blocks, never walks the tree" << endl;
+    cout << "5. Same addChild()/print() shape as the TreeNode example" << endl;
+
+    return 0;
+}
@@ -0,0 +1,298 @@
+/*
+### Buffered, Zero-Copy File Writes
+
+The FileHandle in smart_pointer_advanced.cpp writes line-at-a-time:
+every write() is its own library call and, at high volume, its own
+syscall. A log shipper pushing gigabytes per minute spends more time
+crossing the kernel boundary than writing bytes.
+
+This file adds the buffered engine:
+1. A ring of aligned 1MB buffers; write() appends with a memcpy
+2. A buffer is handed to the OS only when full — one large write
+   replaces thousands of small ones
+3. write_owned() adopts a caller-allocated buffer with NO memcpy:
+   the unique_ptr moves into the flush queue and is written in order
+4. The shared_ptr custom-deleter idiom from the original example
+   still does the final flush + close
+
+Portability note: on POSIX the queued segments would go out through a
+single writev() call; with the MinGW toolchain this project targets,
+each sealed segment is flushed with one large fwrite instead — the
+syscall count is the same either way (one per ~1MB, not one per line).
+
+*/
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+// === Buffered File Handle ===
+
+class BufferedFileHandle
+{
+private:
+    static constexpr size_t BUFFER_SIZE = 1024 * 1024;   // 1MB
+    static constexpr size_t BUFFER_ALIGN = 4096;         // page-aligned
+
+    // A segment is either a ring buffer we filled, or a caller buffer
+    // adopted by write_owned()
+    struct Segment
+    {
+        unique_ptr<char[]> owned;   // set for adopted buffers
+        char* data;
+        size_t length;
+    };
+
+    FILE* file;
+    deque<Segment> flushQueue;      // sealed, waiting to be written
+    unique_ptr<char[]> current;     // buffer being appended to
+    size_t currentUsed = 0;
+    long long flushCalls = 0;
+    long long bytesWritten = 0;
+
+    static unique_ptr<char[]> makeAlignedBuffer()
+    {
+        // Over-allocate and align manually; new[] alignment is not
+        // guaranteed past alignof(max_align_t)
+        return make_unique<char[]>(BUFFER_SIZE + BUFFER_ALIGN);
+    }
+
+    char* alignedBase() const
+    {
+        uintptr_t raw = (uintptr_t)current.get();
+        return (char*)((raw + BUFFER_ALIGN - 1) & ~(uintptr_t)(BUFFER_ALIGN - 1));
+    }
+
+    // Move the partially/fully filled current buffer into the queue
+    void sealCurrent()
+    {
+        if (currentUsed == 0) return;
+
+        Segment seg;
+        seg.data = alignedBase();
+        seg.length = currentUsed;
+        seg.owned = std::move(current);
+        flushQueue.push_back(std::move(seg));
+
+        current = makeAlignedBuffer();
+        currentUsed = 0;
+    }
+
+    // Drain the queue: one large write per segment (writev on POSIX
+    // would batch these into one syscall)
+    void drainQueue()
+    {
+        while (!flushQueue.empty())
+        {
+            Segment& seg = flushQueue.front();
+            fwrite(seg.data, 1, seg.length, file);
+            flushCalls++;
+            bytesWritten += (long long)seg.length;
+            flushQueue.pop_front();
+        }
+    }
+
+public:
+    BufferedFileHandle(const char* filename)
+    {
+        file = fopen(filename, "wb");
+        // Our own 1MB buffering replaces stdio's small default buffer
+        if (file)
+        {
+            setvbuf(file, nullptr, _IONBF, 0);
+        }
+        current = makeAlignedBuffer();
+    }
+
+    ~BufferedFileHandle()
+    {
+        close();
+    }
+
+    void write(const string& text)
+    {
+        size_t needed = text.size() + 1;            // + newline
+        if (currentUsed + needed > BUFFER_SIZE)
+        {
+            sealCurrent();
+            drainQueue();
+        }
+
+        char* dest = alignedBase() + currentUsed;
+        memcpy(dest, text.data(), text.size());
+        dest[text.size()] = '\n';
+        currentUsed += needed;
+    }
+
+    // Zero-copy: adopt the caller's buffer instead of memcpying it.
+    // Ordering is preserved — anything buffered so far is sealed first.
+    void write_owned(unique_ptr<char[]> buffer, size_t length)
+    {
+        sealCurrent();
+
+        Segment seg;
+        seg.data = buffer.get();
+        seg.length = length;
+        seg.owned = std::move(buffer);
+        flushQueue.push_back(std::move(seg));
+        drainQueue();
+    }
+
+    void flush()
+    {
+        sealCurrent();
+        drainQueue();
+        fflush(file);
+    }
+
+    void close()
+    {
+        if (file)
+        {
+            flush();
+            fclose(file);
+            file = nullptr;
+        }
+    }
+
+    long long flushCallCount() const { return flushCalls; }
+    long long totalBytes() const { return bytesWritten; }
+};
+
+// Custom deleter, same idiom as customFileDeleter in
+// smart_pointer_advanced.cpp: final flush + close when the last
+// shared_ptr drops
+void bufferedFileDeleter(BufferedFileHandle* fh)
+{
+    cout << "  [Custom deleter: flushing and closing file]" << endl;
+    fh->close();
+    delete fh;
+}
+
+// === Line-at-a-time baseline (the original FileHandle pattern) ===
+
+class FileHandle
+{
+private:
+    FILE* file;
+
+public:
+    FileHandle(const char* filename)
+    {
+        file = fopen(filename, "wb");
+        if (file)
+        {
+            setvbuf(file, nullptr, _IONBF, 0);      // same terms as above
+        }
+    }
+
+    ~FileHandle()
+    {
+        if (file) fclose(file);
+    }
+
+    void write(const string& text)
+    {
+        if (file)
+        {
+            fprintf(file, "%s\n", text.c_str());    // one call per line
+        }
+    }
+};
+
+int main()
+{
+    const char* BUFFERED_PATH = "test_buffered.log";
+    const char* BASELINE_PATH = "test_baseline.log";
+    const int LINES = 200000;
+    const string line = "2026-09-01T12:00:00Z service=ingest level=info msg=\"chunk accepted\"";
+
+    cout << "=== Example 1: Buffered Writes via shared_ptr + Custom Deleter ===" << endl;
+    {
+        shared_ptr<BufferedFileHandle> filePtr(
+            new BufferedFileHandle(BUFFERED_PATH),
+            bufferedFileDeleter
+        );
+
+        for (int i = 0; i < LINES; ++i)
+        {
+            filePtr->write(line);
+        }
+        filePtr->flush();
+
+        cout << "Wrote " << LINES << " lines (" << filePtr->totalBytes()
+             << " bytes) in " << filePtr->flushCallCount()
+             << " large writes" << endl;
+        cout << "Line-at-a-time would have been " << LINES << " calls" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Throughput vs Line-at-a-Time ===" << endl;
+    {
+        auto start = chrono::steady_clock::now();
+        {
+            FileHandle baseline(BASELINE_PATH);
+            for (int i = 0; i < LINES; ++i)
+            {
+                baseline.write(line);
+            }
+        }
+        auto baselineMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        {
+            BufferedFileHandle buffered(BUFFERED_PATH);
+            for (int i = 0; i < LINES; ++i)
+            {
+                buffered.write(line);
+            }
+        }
+        auto bufferedMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << LINES << " lines:" << endl;
+        cout << "  line-at-a-time (unbuffered FILE): " << baselineMs << " ms" << endl;
+        cout << "  1MB ring buffering:               " << bufferedMs << " ms" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Zero-Copy write_owned ===" << endl;
+    {
+        BufferedFileHandle buffered(BUFFERED_PATH);
+
+        // The caller already owns a big serialized block — adopting it
+        // moves the unique_ptr; the bytes are never copied
+        const size_t BLOCK = 4 * 1024 * 1024;
+        auto block = make_unique<char[]>(BLOCK);
+        memset(block.get(), 'x', BLOCK);
+
+        buffered.write("header line");
+        buffered.write_owned(std::move(block), BLOCK);
+        buffered.write("trailer line");
+        buffered.flush();
+
+        cout << "Adopted a 4MB caller buffer: 0 bytes memcpy'd" << endl;
+        cout << "Total written: " << buffered.totalBytes() << " bytes in "
+             << buffered.flushCallCount() << " writes, order preserved" << endl;
+    }
+
+    remove(BUFFERED_PATH);
+    remove(BASELINE_PATH);
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. 1MB page-aligned buffers: ~1 write per MB, not per line" << endl;
+    cout << "2. write(): memcpy append, flush only on full buffer" << endl;
+    cout << "3. write_owned(): adopt the caller's unique_ptr, zero copy" << endl;
+    cout << "4. Custom deleter still guarantees flush + close on last use" << endl;
+
+    return 0;
+}
@@ -0,0 +1,266 @@
+/*
+### Incremental Cache Reclamation
+
+Cache::cleanup() in smart_pointer_examples.cpp walks the entire map erasing
+expired weak_ptr entries in one pass. With millions of entries that is one
+long stop-the-world scan: every get() waits behind it.
+
+This file demonstrates the incremental alternative:
+1. Expired entries are tombstoned on access (marked, not erased)
+2. A background thread sweeps tombstones in small batches
+3. The lock is only ever held for one batch, so get() never waits
+   behind a full-map scan
+4. Sweep batch size and interval are runtime knobs
+
+
+### Epochs
+- The sweeper stamps each pass with an epoch counter
+- A tombstone is only reclaimed one epoch after it was planted, so a
+  reader that saw the entry just before expiry has finished with it
+  by the time the slot is erased
+
+*/
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+
+using namespace std;
+
+// === Cache with Tombstones and a Background Sweeper ===
+
+template<typename Key, typename Value>
+class ReclaimingCache
+{
+private:
+    struct Slot
+    {
+        weak_ptr<Value> value;
+        bool tombstone = false;
+        uint64_t tombstoneEpoch = 0;
+    };
+
+    map<Key, Slot> cache;
+    mutable mutex lock;
+
+    // Sweeper state
+    thread sweeper;
+    condition_variable wakeup;
+    bool stopping = false;
+    atomic<uint64_t> epoch{1};
+    atomic<size_t> swept{0};
+    atomic<size_t> sweepPasses{0};
+
+    // Runtime knobs
+    size_t sweepBatchSize;
+    chrono::milliseconds sweepInterval;
+
+    // One bounded sweep pass: erase at most sweepBatchSize tombstones,
+    // starting from where the previous pass left off.
+    void sweepBatch()
+    {
+        uint64_t currentEpoch = epoch.fetch_add(1) + 1;
+        Key cursor{};
+        bool haveCursor = false;
+
+        while (true)
+        {
+            lock_guard<mutex> guard(lock);
+            size_t batch = 0;
+
+            auto it = haveCursor ? cache.upper_bound(cursor) : cache.begin();
+            while (it != cache.end() && batch < sweepBatchSize)
+            {
+                // Tombstone anything that expired since the last visit
+                if (!it->second.tombstone && it->second.value.expired())
+                {
+                    it->second.tombstone = true;
+                    it->second.tombstoneEpoch = currentEpoch;
+                }
+
+                // Reclaim tombstones planted in an earlier epoch
+                if (it->second.tombstone && it->second.tombstoneEpoch < currentEpoch)
+                {
+                    it = cache.erase(it);
+                    swept++;
+                }
+                else
+                {
+                    ++it;
+                }
+                batch++;
+            }
+
+            if (it == cache.end())
+            {
+                return;                     // full pass complete
+            }
+
+            cursor = it->first;             // resume here next batch
+            haveCursor = true;
+            // Lock released here: readers run between batches
+        }
+    }
+
+    void sweeperLoop()
+    {
+        unique_lock<mutex> guard(lock);
+        while (!stopping)
+        {
+            wakeup.wait_for(guard, sweepInterval);
+            if (stopping) break;
+
+            guard.unlock();
+            sweepBatch();
+            sweepPasses++;
+            guard.lock();
+        }
+    }
+
+public:
+    ReclaimingCache(size_t batchSize = 64,
+                    chrono::milliseconds interval = chrono::milliseconds(100))
+        : sweepBatchSize(batchSize), sweepInterval(interval)
+    {
+        sweeper = thread(&ReclaimingCache::sweeperLoop, this);
+    }
+
+    ~ReclaimingCache()
+    {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        wakeup.notify_one();
+        sweeper.join();
+    }
+
+    shared_ptr<Value> get(const Key& key)
+    {
+        lock_guard<mutex> guard(lock);
+
+        auto it = cache.find(key);
+        if (it == cache.end() || it->second.tombstone)
+        {
+            return nullptr;
+        }
+
+        if (auto cached = it->second.value.lock())
+        {
+            return cached;
+        }
+
+        // Expired: tombstone it instead of erasing — no rebalancing,
+        // no full-map walk, the sweeper reclaims it later
+        it->second.tombstone = true;
+        it->second.tombstoneEpoch = epoch.load();
+        return nullptr;
+    }
+
+    void put(const Key& key, shared_ptr<Value> value)
+    {
+        lock_guard<mutex> guard(lock);
+        cache[key] = Slot{value, false, 0};
+    }
+
+    size_t slotCount() const
+    {
+        lock_guard<mutex> guard(lock);
+        return cache.size();
+    }
+
+    size_t sweptCount() const { return swept; }
+    size_t passCount() const { return sweepPasses; }
+};
+
+int main()
+{
+    cout << "=== Example 1: Tombstone on Access ===" << endl;
+    {
+        ReclaimingCache<string, string> cache(64, chrono::milliseconds(50));
+
+        {
+            auto data = make_shared<string>("short-lived");
+            cache.put("key1", data);
+            cout << "Cached key1, slots: " << cache.slotCount() << endl;
+        }
+        // data destroyed: the weak_ptr in the cache is now expired
+
+        auto result = cache.get("key1");
+        cout << "get(key1) after expiry: " << (result ? "hit" : "miss") << endl;
+        cout << "Slot still present (tombstoned, not erased): "
+             << cache.slotCount() << endl;
+
+        // Give the sweeper two intervals: one to advance the epoch,
+        // one to reclaim the old-epoch tombstone
+        this_thread::sleep_for(chrono::milliseconds(200));
+        cout << "After background sweep, slots: " << cache.slotCount() << endl;
+        cout << "Entries reclaimed by sweeper: " << cache.sweptCount() << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Bounded Sweep Batches ===" << endl;
+    {
+        // Small batch size so a large expired population takes several
+        // lock acquisitions instead of one long scan
+        ReclaimingCache<int, int> cache(100, chrono::milliseconds(20));
+
+        {
+            vector<shared_ptr<int>> keepAlive;
+            for (int i = 0; i < 5000; ++i)
+            {
+                auto value = make_shared<int>(i);
+                cache.put(i, value);
+                keepAlive.push_back(value);
+            }
+            cout << "Cached 5000 live entries" << endl;
+        }
+        // All 5000 just expired at once — the worst case for cleanup()
+
+        // Readers keep running while the sweeper works in 100-entry batches
+        auto start = chrono::steady_clock::now();
+        long long maxGetNs = 0;
+        while (cache.slotCount() > 0)
+        {
+            auto t0 = chrono::steady_clock::now();
+            cache.get(2500);
+            auto dt = chrono::duration_cast<chrono::nanoseconds>(
+                chrono::steady_clock::now() - t0).count();
+            if (dt > maxGetNs) maxGetNs = dt;
+
+            if (chrono::steady_clock::now() - start > chrono::seconds(5)) break;
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+
+        cout << "All slots reclaimed in " << cache.passCount() << " sweep passes" << endl;
+        cout << "Entries swept: " << cache.sweptCount() << endl;
+        cout << "Worst get() latency during sweeping: " << maxGetNs << " ns" << endl;
+        cout << "(cleanup() would have stalled one get() for the whole scan)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Runtime Knobs ===" << endl;
+    {
+        cout << "Batch size controls the worst-case lock hold per sweep step" << endl;
+        cout << "Interval controls how quickly dead slots are reclaimed" << endl;
+        cout << endl;
+        cout << "  Aggressive:   ReclaimingCache cache(1024, 10ms)" << endl;
+        cout << "  Low-impact:   ReclaimingCache cache(32, 500ms)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. get() never erases: expired entries become tombstones" << endl;
+    cout << "2. Sweeper erases in bounded batches, releasing the lock between" << endl;
+    cout << "3. Epoch delay: a tombstone survives one full epoch before erase" << endl;
+    cout << "4. Batch size and interval tune pause vs. reclamation speed" << endl;
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+/*
+### Command Journal with POD Records
+
+The Command/AddCommand framework in smart_pointer_examples.cpp heap-
+allocates a polymorphic object per operation and replays through
+virtual calls. For an audit pipeline replaying millions of commands,
+the allocation plus vtable dispatch caps throughput.
+
+This file shows the journal alternative:
+1. Commands are 8-byte POD records appended to a contiguous log —
+   no per-command allocation, no vtable pointer
+2. Replay is a switch over a tag byte: the branch predictor learns
+   it, and records stream linearly through the cache
+3. snapshot() compacts the journal: the current value is captured
+   and old records are truncated, so undo-history memory is bounded
+4. execute()/undo()/redo() stay the user-facing API
+
+*/
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+using namespace std;
+
+// === The polymorphic baseline (as in smart_pointer_examples.cpp) ===
+
+class Command
+{
+public:
+    virtual ~Command() = default;
+    virtual void execute() = 0;
+    virtual void undo() = 0;
+};
+
+class AddCommand : public Command
+{
+private:
+    long long& value;
+    int amount;
+
+public:
+    AddCommand(long long& val, int amt) : value(val), amount(amt) {}
+    void execute() override { value += amount; }
+    void undo() override { value -= amount; }
+};
+
+// === The journal ===
+
+enum class OpTag : uint8_t
+{
+    Add,
+    Subtract,
+    Multiply
+};
+
+// One operation = 8 bytes, trivially copyable, no heap
+struct CommandRecord
+{
+    OpTag tag;
+    int32_t operand;
+};
+
+class CommandJournal
+{
+private:
+    long long& value;
+    long long snapshotValue;            // value when the log was last compacted
+    vector<CommandRecord> log;          // records since the snapshot
+    size_t undoTop = 0;                 // records [0, undoTop) are applied
+
+    static void apply(long long& v, const CommandRecord& record)
+    {
+        switch (record.tag)             // tag dispatch, no virtual call
+        {
+            case OpTag::Add:      v += record.operand; break;
+            case OpTag::Subtract: v -= record.operand; break;
+            case OpTag::Multiply: v *= record.operand; break;
+        }
+    }
+
+    static void revert(long long& v, const CommandRecord& record)
+    {
+        switch (record.tag)
+        {
+            case OpTag::Add:      v -= record.operand; break;
+            case OpTag::Subtract: v += record.operand; break;
+            case OpTag::Multiply: v /= record.operand; break;
+        }
+    }
+
+public:
+    CommandJournal(long long& target) : value(target), snapshotValue(target) {}
+
+    void execute(OpTag tag, int32_t operand)
+    {
+        CommandRecord record{tag, operand};
+        apply(value, record);
+
+        // New command invalidates any redo tail
+        log.resize(undoTop);
+        log.push_back(record);
+        undoTop = log.size();
+    }
+
+    void undo()
+    {
+        if (undoTop == 0)
+        {
+            cout << "  Nothing to undo" << endl;
+            return;
+        }
+        undoTop--;
+        revert(value, log[undoTop]);
+    }
+
+    void redo()
+    {
+        if (undoTop == log.size())
+        {
+            cout << "  Nothing to redo" << endl;
+            return;
+        }
+        apply(value, log[undoTop]);
+        undoTop++;
+    }
+
+    // Compaction: capture the current value as the new baseline and
+    // drop the records behind it. Bounds journal memory; history
+    // before the snapshot is no longer undoable (like a DB checkpoint).
+    void snapshot()
+    {
+        snapshotValue = value;
+        log.clear();
+        undoTop = 0;
+    }
+
+    // Rebuild the value from the snapshot by streaming the log —
+    // this is the audit-replay path
+    long long replay() const
+    {
+        long long v = snapshotValue;
+        for (size_t i = 0; i < undoTop; ++i)
+        {
+            apply(v, log[i]);
+        }
+        return v;
+    }
+
+    size_t recordCount() const { return log.size(); }
+    size_t bytesUsed() const { return log.size() * sizeof(CommandRecord); }
+};
+
+int main()
+{
+    cout << "=== Example 1: execute/undo/redo API ===" << endl;
+    {
+        long long value = 10;
+        CommandJournal journal(value);
+
+        cout << "Initial value: " << value << endl;
+
+        journal.execute(OpTag::Add, 5);
+        journal.execute(OpTag::Multiply, 2);
+        journal.execute(OpTag::Add, 10);
+        cout << "After add 5, multiply 2, add 10: " << value << endl;
+
+        journal.undo();
+        journal.undo();
+        cout << "After two undos: " << value << endl;
+
+        journal.redo();
+        cout << "After redo: " << value << endl;
+
+        cout << "Journal: " << journal.recordCount() << " records, "
+             << journal.bytesUsed() << " bytes" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Snapshot Compaction ===" << endl;
+    {
+        long long value = 0;
+        CommandJournal journal(value);
+
+        for (int i = 0; i < 100000; ++i)
+        {
+            journal.execute(OpTag::Add, 1);
+        }
+        cout << "100000 commands, journal bytes: " << journal.bytesUsed() << endl;
+
+        journal.snapshot();
+        cout << "After snapshot, journal bytes: " << journal.bytesUsed()
+             << " (value preserved: " << value << ")" << endl;
+
+        journal.execute(OpTag::Add, 7);
+        cout << "New commands journal from the snapshot: value = "
+             << journal.replay() << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Replay Throughput vs Virtual Commands ===" << endl;
+    {
+        const int OPS = 5000000;
+
+        // Polymorphic: one heap object per command
+        long long valueA = 0;
+        vector<unique_ptr<Command>> commands;
+        commands.reserve(OPS);
+        for (int i = 0; i < OPS; ++i)
+        {
+            commands.push_back(make_unique<AddCommand>(valueA, 1));
+        }
+
+        auto start = chrono::steady_clock::now();
+        for (auto& cmd : commands)
+        {
+            cmd->execute();
+        }
+        auto virtualMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        // Journal: 8-byte records, tag switch
+        long long valueB = 0;
+        CommandJournal journal(valueB);
+        for (int i = 0; i < OPS; ++i)
+        {
+            journal.execute(OpTag::Add, 1);
+        }
+
+        start = chrono::steady_clock::now();
+        long long replayed = journal.replay();
+        auto journalMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << OPS << " command replay:" << endl;
+        cout << "  virtual objects: " << virtualMs << " ms" << endl;
+        cout << "  POD journal:     " << journalMs << " ms" << endl;
+        cout << "Results match: " << (valueA == replayed ? "OK" : "MISMATCH") << endl;
+        cout << "Memory per op: " << sizeof(CommandRecord)
+             << " bytes vs heap object + unique_ptr + vtable" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. POD records: append-only contiguous log, zero allocation" << endl;
+    cout << "2. Tag switch replay: predictable branches, streaming reads" << endl;
+    cout << "3. snapshot(): checkpoint + truncate bounds history memory" << endl;
+    cout << "4. Same execute()/undo()/redo() surface as the Command class" << endl;
+
+    return 0;
+}
@@ -0,0 +1,291 @@
+/*
+### Connection Pool with Lock-Free Acquire
+
+DatabaseConnection in smart_pointer_examples.cpp models a full
+connect/query/disconnect lifecycle per use. In production the connect
+step is the expensive part, so hot paths should borrow a pre-connected
+instance instead of building one.
+
+This file shows a real pool around that class:
+1. A fixed-size set of connections, all connected up front
+2. Lock-free acquire/release: the free list is an atomic stack of
+   slot indices — acquire is one CAS, release is one CAS
+3. A version tag in the stack head defeats the ABA problem
+4. RAII handles built on the shared_ptr custom-deleter idiom: when
+   the handle drops, the connection returns to the pool
+5. Health checks run in a background sweep, never on the hot path
+
+*/
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+
+using namespace std;
+
+// === The connection itself (shape from smart_pointer_examples.cpp) ===
+
+class DatabaseConnection
+{
+private:
+    string connectionString;
+    bool connected;
+    long long queriesRun = 0;
+
+public:
+    DatabaseConnection(const string& connStr) : connectionString(connStr), connected(true)
+    {
+        // Stand-in for the expensive part: DNS, TCP, TLS, auth...
+        this_thread::sleep_for(chrono::milliseconds(2));
+    }
+
+    void query(const string& sql)
+    {
+        if (connected)
+        {
+            (void)sql;
+            queriesRun++;
+        }
+    }
+
+    bool healthy() const { return connected; }
+    void markBroken() { connected = false; }
+
+    void reconnect()
+    {
+        this_thread::sleep_for(chrono::milliseconds(2));
+        connected = true;
+    }
+
+    long long queryCount() const { return queriesRun; }
+    const string& target() const { return connectionString; }
+};
+
+// === The pool ===
+
+class ConnectionPool
+{
+private:
+    vector<unique_ptr<DatabaseConnection>> connections;
+    vector<atomic<uint32_t>> nextFree;      // per-slot link in the free stack
+    vector<atomic<bool>> inUse;             // for the health sweep only
+
+    // Free-list head: low 32 bits = slot index, high 32 bits = version.
+    // The version changes on every pop, so a stale head from an
+    // interrupted CAS can never match again (ABA defense).
+    atomic<uint64_t> freeHead;
+
+    static constexpr uint32_t NIL = 0xFFFFFFFF;
+
+    static uint64_t packHead(uint32_t index, uint32_t version)
+    {
+        return ((uint64_t)version << 32) | index;
+    }
+    static uint32_t headIndex(uint64_t head) { return (uint32_t)head; }
+    static uint32_t headVersion(uint64_t head) { return (uint32_t)(head >> 32); }
+
+    void release(uint32_t slot)
+    {
+        inUse[slot].store(false, memory_order_release);
+
+        uint64_t head = freeHead.load(memory_order_relaxed);
+        while (true)
+        {
+            nextFree[slot].store(headIndex(head), memory_order_relaxed);
+            uint64_t newHead = packHead(slot, headVersion(head) + 1);
+            if (freeHead.compare_exchange_weak(head, newHead,
+                                               memory_order_release,
+                                               memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+public:
+    ConnectionPool(const string& connStr, size_t size)
+        : nextFree(size), inUse(size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            connections.push_back(make_unique<DatabaseConnection>(connStr));
+            nextFree[i].store(i + 1 < size ? (uint32_t)(i + 1) : NIL);
+            inUse[i].store(false);
+        }
+        freeHead.store(packHead(0, 0));
+    }
+
+    // One CAS on success; returns nullptr if the pool is exhausted.
+    // The shared_ptr's deleter returns the connection instead of
+    // destroying it — callers just let the handle go out of scope.
+    shared_ptr<DatabaseConnection> acquire()
+    {
+        uint64_t head = freeHead.load(memory_order_acquire);
+        while (true)
+        {
+            uint32_t slot = headIndex(head);
+            if (slot == NIL)
+            {
+                return nullptr;             // pool exhausted
+            }
+
+            uint32_t next = nextFree[slot].load(memory_order_relaxed);
+            uint64_t newHead = packHead(next, headVersion(head) + 1);
+            if (freeHead.compare_exchange_weak(head, newHead,
+                                               memory_order_acquire,
+                                               memory_order_acquire))
+            {
+                inUse[slot].store(true, memory_order_release);
+                return shared_ptr<DatabaseConnection>(
+                    connections[slot].get(),
+                    [this, slot](DatabaseConnection*) { release(slot); });
+            }
+        }
+    }
+
+    // Off-hot-path maintenance: fix broken idle connections. Runs from
+    // a background thread; never touches connections currently in use.
+    size_t runHealthChecks()
+    {
+        size_t repaired = 0;
+        for (size_t i = 0; i < connections.size(); ++i)
+        {
+            if (!inUse[i].load(memory_order_acquire) && !connections[i]->healthy())
+            {
+                connections[i]->reconnect();
+                repaired++;
+            }
+        }
+        return repaired;
+    }
+
+    size_t size() const { return connections.size(); }
+};
+
+int main()
+{
+    cout << "=== Example 1: Borrow, Use, Auto-Return ===" << endl;
+    {
+        ConnectionPool pool("localhost:5432", 4);
+        cout << "Pool of " << pool.size() << " pre-connected instances" << endl;
+
+        {
+            auto conn = pool.acquire();
+            conn->query("SELECT * FROM users");
+            conn->query("INSERT INTO logs VALUES (...)");
+            cout << "Borrowed a connection, ran " << conn->queryCount()
+                 << " queries" << endl;
+        }
+        cout << "Handle dropped: connection returned to the pool, not closed" << endl;
+
+        auto again = pool.acquire();
+        cout << "Re-acquired: same instance, " << again->queryCount()
+             << " queries already on it" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Exhaustion ===" << endl;
+    {
+        ConnectionPool pool("localhost:5432", 2);
+
+        auto c1 = pool.acquire();
+        auto c2 = pool.acquire();
+        auto c3 = pool.acquire();
+
+        cout << "Acquired 2 of 2; third acquire: "
+             << (c3 ? "granted (BUG)" : "nullptr (pool exhausted)") << endl;
+
+        c1.reset();
+        c3 = pool.acquire();
+        cout << "After one release, acquire again: "
+             << (c3 ? "granted" : "still empty") << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Acquire Cost vs Connect-Per-Use ===" << endl;
+    {
+        const int USES = 1000;
+        ConnectionPool pool("localhost:5432", 8);
+
+        // Connect-per-use: pay the setup cost every time
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < 5; ++i)     // 5 is enough to see the point
+        {
+            DatabaseConnection conn("localhost:5432");
+            conn.query("SELECT 1");
+        }
+        auto connectUs = chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - start).count() / 5;
+
+        // Pooled: one CAS per borrow
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < USES; ++i)
+        {
+            auto conn = pool.acquire();
+            conn->query("SELECT 1");
+        }
+        auto pooledNs = chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start).count() / USES;
+
+        cout << "Connect-per-use: ~" << connectUs << " us per use" << endl;
+        cout << "Pooled acquire:  ~" << pooledNs << " ns per use" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 4: Concurrent Borrowers + Background Health Sweep ===" << endl;
+    {
+        ConnectionPool pool("localhost:5432", 8);
+        atomic<long long> totalQueries{0};
+        atomic<bool> stop{false};
+
+        thread healthSweeper([&]() {
+            while (!stop.load())
+            {
+                pool.runHealthChecks();
+                this_thread::sleep_for(chrono::milliseconds(10));
+            }
+        });
+
+        vector<thread> workers;
+        for (int w = 0; w < 4; ++w)
+        {
+            workers.emplace_back([&]() {
+                for (int i = 0; i < 20000; ++i)
+                {
+                    auto conn = pool.acquire();
+                    if (conn)
+                    {
+                        conn->query("SELECT 1");
+                        totalQueries++;
+                    }
+                    else
+                    {
+                        this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& t : workers) t.join();
+        stop.store(true);
+        healthSweeper.join();
+
+        cout << "4 threads completed, queries served: " << totalQueries << endl;
+        cout << "Health checks ran concurrently, never blocking acquire" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Pre-connected fixed pool: setup cost paid once" << endl;
+    cout << "2. Atomic index stack: acquire/release are one CAS each" << endl;
+    cout << "3. Versioned head: the classic ABA fix for lock-free stacks" << endl;
+    cout << "4. shared_ptr custom deleter: RAII return, familiar idiom" << endl;
+    cout << "5. Health sweep repairs idle connections off the hot path" << endl;
+
+    return 0;
+}
@@ -0,0 +1,348 @@
+/*
+### Sharded LRU Cache Engine
+
+This file grows the weak_ptr Cache from smart_pointer_examples.cpp into a
+cache subsystem suitable for many-core frontends:
+1. N-way sharding by key hash (one lock per shard, not one global lock)
+2. Fine-grained per-shard locking so threads rarely contend
+3. LRU eviction driven by a configurable byte budget
+4. get_or_compute() that coalesces concurrent misses for the same key
+
+
+### Why shard?
+- A single map + mutex serializes every reader on every core
+- With 16 shards, two threads only contend when their keys hash to
+  the same shard (~6% of the time)
+
+
+### Why LRU with a byte budget?
+- weak_ptr caches evict only when the owner drops the object
+- Production caches must bound their own memory instead
+
+
+### Why get_or_compute()?
+- On a miss, every waiting thread would otherwise recompute the value
+- Coalescing means one thread computes, the rest share the result
+
+*/
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <map>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <future>
+#include <functional>
+
+using namespace std;
+
+// === Sharded LRU Cache ===
+
+template<typename Key, typename Value>
+class ShardedLruCache
+{
+private:
+    struct Entry
+    {
+        shared_ptr<Value> value;
+        size_t bytes;
+        typename list<Key>::iterator lruPos;
+    };
+
+    struct Shard
+    {
+        mutable mutex lock;
+        map<Key, Entry> entries;
+        list<Key> lruOrder;                           // front = most recent
+        map<Key, shared_future<shared_ptr<Value>>> inFlight;
+        size_t bytesUsed = 0;
+    };
+
+    vector<unique_ptr<Shard>> shards;
+    size_t shardMask;
+    size_t byteBudgetPerShard;
+    atomic<size_t> hits{0};
+    atomic<size_t> misses{0};
+    atomic<size_t> evictions{0};
+
+    Shard& shardFor(const Key& key)
+    {
+        return *shards[hash<Key>{}(key) & shardMask];
+    }
+
+    // Caller must hold shard.lock
+    void evictIfNeeded(Shard& shard)
+    {
+        while (shard.bytesUsed > byteBudgetPerShard && !shard.lruOrder.empty())
+        {
+            const Key& victim = shard.lruOrder.back();
+            auto it = shard.entries.find(victim);
+            shard.bytesUsed -= it->second.bytes;
+            shard.entries.erase(it);
+            shard.lruOrder.pop_back();
+            evictions++;
+        }
+    }
+
+    // Caller must hold shard.lock
+    void insertLocked(Shard& shard, const Key& key, shared_ptr<Value> value, size_t bytes)
+    {
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end())
+        {
+            shard.bytesUsed -= it->second.bytes;
+            shard.lruOrder.erase(it->second.lruPos);
+            shard.entries.erase(it);
+        }
+
+        shard.lruOrder.push_front(key);
+        shard.entries[key] = Entry{std::move(value), bytes, shard.lruOrder.begin()};
+        shard.bytesUsed += bytes;
+        evictIfNeeded(shard);
+    }
+
+public:
+    // shardCount must be a power of two
+    ShardedLruCache(size_t shardCount, size_t totalByteBudget)
+        : shardMask(shardCount - 1),
+          byteBudgetPerShard(totalByteBudget / shardCount)
+    {
+        for (size_t i = 0; i < shardCount; ++i)
+        {
+            shards.push_back(make_unique<Shard>());
+        }
+    }
+
+    shared_ptr<Value> get(const Key& key)
+    {
+        Shard& shard = shardFor(key);
+        lock_guard<mutex> guard(shard.lock);
+
+        auto it = shard.entries.find(key);
+        if (it == shard.entries.end())
+        {
+            misses++;
+            return nullptr;
+        }
+
+        // Move to front of LRU list (O(1) splice)
+        shard.lruOrder.splice(shard.lruOrder.begin(), shard.lruOrder, it->second.lruPos);
+        hits++;
+        return it->second.value;
+    }
+
+    void put(const Key& key, shared_ptr<Value> value, size_t bytes)
+    {
+        Shard& shard = shardFor(key);
+        lock_guard<mutex> guard(shard.lock);
+        insertLocked(shard, key, std::move(value), bytes);
+    }
+
+    // Concurrent misses for the same key coalesce: only the first caller
+    // runs computeFn, the rest wait on its shared_future.
+    shared_ptr<Value> get_or_compute(const Key& key,
+                                     function<shared_ptr<Value>()> computeFn,
+                                     size_t bytes)
+    {
+        Shard& shard = shardFor(key);
+
+        unique_lock<mutex> guard(shard.lock);
+
+        // Fast path: already cached
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end())
+        {
+            shard.lruOrder.splice(shard.lruOrder.begin(), shard.lruOrder,
+                                  it->second.lruPos);
+            hits++;
+            return it->second.value;
+        }
+
+        // Another thread is already computing this key: share its result
+        auto flight = shard.inFlight.find(key);
+        if (flight != shard.inFlight.end())
+        {
+            shared_future<shared_ptr<Value>> pending = flight->second;
+            guard.unlock();
+            hits++;
+            return pending.get();
+        }
+
+        // We are the computing thread: register a promise before releasing
+        // the lock so later callers find it and wait instead of recomputing
+        promise<shared_ptr<Value>> p;
+        shard.inFlight[key] = p.get_future().share();
+        misses++;
+        guard.unlock();
+
+        shared_ptr<Value> value = computeFn();
+
+        guard.lock();
+        insertLocked(shard, key, value, bytes);
+        shard.inFlight.erase(key);
+        p.set_value(value);
+        return value;
+    }
+
+    size_t size() const
+    {
+        size_t total = 0;
+        for (const auto& shard : shards)
+        {
+            lock_guard<mutex> guard(shard->lock);
+            total += shard->entries.size();
+        }
+        return total;
+    }
+
+    size_t bytesUsed() const
+    {
+        size_t total = 0;
+        for (const auto& shard : shards)
+        {
+            lock_guard<mutex> guard(shard->lock);
+            total += shard->bytesUsed;
+        }
+        return total;
+    }
+
+    void printStats() const
+    {
+        cout << "  Hits: " << hits << ", Misses: " << misses
+             << ", Evictions: " << evictions << endl;
+        cout << "  Entries: " << size() << ", Bytes: " << bytesUsed() << endl;
+    }
+};
+
+int main()
+{
+    cout << "=== Example 1: Basic Put/Get Across Shards ===" << endl;
+    {
+        ShardedLruCache<string, string> cache(16, 16 * 1024);
+
+        cache.put("session:alice", make_shared<string>("alice-data"), 64);
+        cache.put("session:bob", make_shared<string>("bob-data"), 64);
+        cache.put("session:carol", make_shared<string>("carol-data"), 64);
+
+        auto value = cache.get("session:bob");
+        if (value)
+        {
+            cout << "Found session:bob -> " << *value << endl;
+        }
+
+        if (!cache.get("session:dave"))
+        {
+            cout << "session:dave not cached (miss)" << endl;
+        }
+
+        cache.printStats();
+    }
+    cout << endl;
+
+    cout << "=== Example 2: LRU Eviction Under a Byte Budget ===" << endl;
+    {
+        // Tiny budget: 1 shard, 300 bytes -> holds three 100-byte entries
+        ShardedLruCache<string, string> cache(1, 300);
+
+        cache.put("a", make_shared<string>("A"), 100);
+        cache.put("b", make_shared<string>("B"), 100);
+        cache.put("c", make_shared<string>("C"), 100);
+
+        cout << "Cached a, b, c (budget full)" << endl;
+
+        // Touch "a" so it becomes most-recently-used
+        cache.get("a");
+        cout << "Touched a (now most recent)" << endl;
+
+        // Inserting "d" must evict the least-recently-used entry: "b"
+        cache.put("d", make_shared<string>("D"), 100);
+        cout << "Inserted d" << endl;
+
+        cout << "a present: " << (cache.get("a") != nullptr) << endl;
+        cout << "b present: " << (cache.get("b") != nullptr) << " (evicted as LRU)" << endl;
+        cout << "c present: " << (cache.get("c") != nullptr) << endl;
+        cout << "d present: " << (cache.get("d") != nullptr) << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Coalesced get_or_compute() ===" << endl;
+    {
+        ShardedLruCache<string, string> cache(16, 16 * 1024);
+        atomic<int> computeCount{0};
+
+        auto expensiveCompute = [&computeCount]() {
+            computeCount++;
+            this_thread::sleep_for(chrono::milliseconds(50));
+            return make_shared<string>("computed-config");
+        };
+
+        // 8 threads all miss on the same key at once
+        vector<thread> threads;
+        for (int i = 0; i < 8; ++i)
+        {
+            threads.emplace_back([&]() {
+                auto value = cache.get_or_compute("config:main", expensiveCompute, 128);
+                (void)value;
+            });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        cout << "8 concurrent requests, computations run: " << computeCount << endl;
+        cout << "Without coalescing this would have been 8 computations" << endl;
+        cache.printStats();
+    }
+    cout << endl;
+
+    cout << "=== Example 4: Concurrent Throughput Across Shards ===" << endl;
+    {
+        ShardedLruCache<int, int> cache(16, 1024 * 1024);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            cache.put(i, make_shared<int>(i * i), 32);
+        }
+
+        auto worker = [&cache](int seed) {
+            for (int i = 0; i < 100000; ++i)
+            {
+                cache.get((seed * 7 + i) % 1000);
+            }
+        };
+
+        auto start = chrono::steady_clock::now();
+
+        vector<thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back(worker, t);
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << "4 threads x 100K lookups in " << elapsed << " ms" << endl;
+        cout << "Each lookup only locks 1 of 16 shards" << endl;
+        cache.printStats();
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Sharding: contention drops by ~1/N with N shards" << endl;
+    cout << "2. LRU via list + splice: O(1) touch, O(1) evict" << endl;
+    cout << "3. Byte budget: cache bounds its own memory" << endl;
+    cout << "4. get_or_compute: thundering-herd misses collapse to one" << endl;
+
+    return 0;
+}
@@ -0,0 +1,284 @@
+/*
+### Slot-Based Observer Dispatch with Batched Notification
+
+The Subject in smart_pointer_examples.cpp locks every weak_ptr observer
+for every message — two atomic ref-count operations per observer per
+event, plus an erase-remove sweep on each notify. At hundreds of
+thousands of events per second across thousands of observers, the
+ref-count traffic becomes the hottest frame in the profile.
+
+This file shows the high-throughput variant:
+1. Observers register into a stable slot array; a slot index stays
+   valid for the observer's lifetime
+2. Dead slots are detected during delivery and swept lazily — not
+   on every notify
+3. notify_batch() delivers a burst of messages per observer visit,
+   so one weak_ptr::lock() is amortized over the whole burst
+
+*/
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+
+using namespace std;
+
+// === Observer interface (same shape as smart_pointer_examples.cpp) ===
+
+class Observer
+{
+public:
+    virtual ~Observer() = default;
+    virtual void onNotify(const string& message) = 0;
+};
+
+class CountingObserver : public Observer
+{
+private:
+    long long received = 0;
+
+public:
+    void onNotify(const string&) override
+    {
+        received++;
+    }
+
+    long long receivedCount() const { return received; }
+};
+
+// === Per-Message Locking Subject (the baseline pattern) ===
+
+class Subject
+{
+private:
+    vector<weak_ptr<Observer>> observers;
+
+public:
+    void attach(shared_ptr<Observer> obs)
+    {
+        observers.push_back(obs);
+    }
+
+    void notify(const string& message)
+    {
+        for (auto& weakObs : observers)
+        {
+            if (auto obs = weakObs.lock())   // 2 atomic ops per observer
+            {
+                obs->onNotify(message);
+            }
+        }
+    }
+};
+
+// === Slot-Based Subject ===
+
+class FastSubject
+{
+private:
+    struct Slot
+    {
+        weak_ptr<Observer> observer;
+        bool occupied = false;
+    };
+
+    vector<Slot> slots;
+    vector<size_t> freeSlots;       // recycled slot indices
+    size_t deadSeen = 0;            // expired slots noticed during delivery
+
+    // Sweep only when enough corpses have piled up — never on the
+    // notify hot path itself
+    static constexpr size_t SWEEP_THRESHOLD = 64;
+
+    void sweepDead()
+    {
+        for (size_t i = 0; i < slots.size(); ++i)
+        {
+            if (slots[i].occupied && slots[i].observer.expired())
+            {
+                slots[i].occupied = false;
+                slots[i].observer.reset();
+                freeSlots.push_back(i);
+            }
+        }
+        deadSeen = 0;
+    }
+
+    void noteDead()
+    {
+        if (++deadSeen >= SWEEP_THRESHOLD)
+        {
+            sweepDead();
+        }
+    }
+
+public:
+    // Returns a stable slot index; the observer can be found there
+    // until it is detached or destroyed
+    size_t attach(shared_ptr<Observer> obs)
+    {
+        size_t index;
+        if (!freeSlots.empty())
+        {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        else
+        {
+            slots.push_back(Slot{});
+            index = slots.size() - 1;
+        }
+        slots[index].observer = obs;
+        slots[index].occupied = true;
+        return index;
+    }
+
+    void detach(size_t slotIndex)
+    {
+        slots[slotIndex].occupied = false;
+        slots[slotIndex].observer.reset();
+        freeSlots.push_back(slotIndex);
+    }
+
+    void notify(const string& message)
+    {
+        for (Slot& slot : slots)
+        {
+            if (!slot.occupied) continue;
+
+            if (auto obs = slot.observer.lock())
+            {
+                obs->onNotify(message);
+            }
+            else
+            {
+                noteDead();                 // swept later, not now
+            }
+        }
+    }
+
+    // One lock per observer per BURST instead of per message: the
+    // ref-count cost is divided by the batch size
+    void notify_batch(const vector<string>& messages)
+    {
+        for (Slot& slot : slots)
+        {
+            if (!slot.occupied) continue;
+
+            if (auto obs = slot.observer.lock())
+            {
+                for (const string& message : messages)
+                {
+                    obs->onNotify(message);
+                }
+            }
+            else
+            {
+                noteDead();
+            }
+        }
+    }
+
+    size_t slotCount() const { return slots.size(); }
+    size_t freeCount() const { return freeSlots.size(); }
+};
+
+int main()
+{
+    cout << "=== Example 1: Stable Slots and Lazy Sweeping ===" << endl;
+    {
+        FastSubject subject;
+
+        auto obs1 = make_shared<CountingObserver>();
+        auto obs3 = make_shared<CountingObserver>();
+
+        size_t slot1 = subject.attach(obs1);
+        size_t slot2;
+        {
+            auto obs2 = make_shared<CountingObserver>();
+            slot2 = subject.attach(obs2);
+            subject.attach(obs3);
+
+            subject.notify("event-1");
+            cout << "obs2 alive: delivered to all 3 slots" << endl;
+        }
+        // obs2 destroyed: its slot is now dead but NOT erased
+
+        subject.notify("event-2");
+        cout << "obs2 dead: slot " << slot2 << " skipped, swept lazily" << endl;
+        cout << "Slots: " << subject.slotCount()
+             << ", freed so far: " << subject.freeCount() << endl;
+
+        cout << "obs1 received " << obs1->receivedCount()
+             << ", obs3 received " << obs3->receivedCount() << endl;
+
+        subject.detach(slot1);
+        cout << "After detach, free slots: " << subject.freeCount()
+             << " (indices recycle, array never shifts)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: Per-Message vs Batched Notification ===" << endl;
+    {
+        const int OBSERVERS = 1000;
+        const int MESSAGES = 2048;      // multiple of BATCH
+        const size_t BATCH = 64;
+
+        // Baseline: lock every observer for every message
+        Subject baseline;
+        vector<shared_ptr<CountingObserver>> group1;
+        for (int i = 0; i < OBSERVERS; ++i)
+        {
+            auto obs = make_shared<CountingObserver>();
+            group1.push_back(obs);
+            baseline.attach(obs);
+        }
+
+        auto start = chrono::steady_clock::now();
+        for (int m = 0; m < MESSAGES; ++m)
+        {
+            baseline.notify("event");
+        }
+        auto baselineMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        // Batched: lock every observer once per 64-message burst
+        FastSubject batched;
+        vector<shared_ptr<CountingObserver>> group2;
+        for (int i = 0; i < OBSERVERS; ++i)
+        {
+            auto obs = make_shared<CountingObserver>();
+            group2.push_back(obs);
+            batched.attach(obs);
+        }
+
+        vector<string> burst(BATCH, "event");
+        start = chrono::steady_clock::now();
+        for (int m = 0; m < MESSAGES; m += (int)BATCH)
+        {
+            batched.notify_batch(burst);
+        }
+        auto batchedMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << OBSERVERS << " observers x " << MESSAGES << " messages:" << endl;
+        cout << "  per-message locking: " << baselineMs << " ms ("
+             << (long long)OBSERVERS * MESSAGES << " weak_ptr locks)" << endl;
+        cout << "  notify_batch(" << BATCH << "):    " << batchedMs << " ms ("
+             << (long long)OBSERVERS * (MESSAGES / BATCH) << " weak_ptr locks)" << endl;
+
+        cout << "Delivery check: "
+             << (group1[0]->receivedCount() == group2[0]->receivedCount()
+                 ? "OK" : "MISMATCH") << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Slot array: attach/detach are O(1), indices stay stable" << endl;
+    cout << "2. Dead slots skipped on delivery, swept after a threshold" << endl;
+    cout << "3. notify_batch: ref-count cost divided by batch size" << endl;
+
+    return 0;
+}
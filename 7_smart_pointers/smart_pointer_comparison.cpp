@@ -120,15 +120,152 @@ weak_ptr:
 - Can safely check existence from multiple threads
 - Object access still needs synchronization
 
+
+### The Fourth Option: Generational Handles
+
+HandlePool<T> below adds the pointer kind this comparison was missing.
+Objects live in one contiguous slab; callers hold a 64-bit handle
+(32-bit slot index + 32-bit generation) instead of a pointer:
+
+- Validity check is two loads and a compare — no atomics, unlike the
+  shared_ptr control block whose count ping-pongs between cores
+- Use-after-free safety without ownership: destroying a slot bumps its
+  generation, so every stale handle fails validation forever
+- Iteration walks the slab in memory order, not pointer-chase order
+
+                    handle          shared_ptr      weak_ptr
+Validity check:     2 loads         n/a (owns)      lock() + atomic
+Deref:              index + check   direct          via lock()
+Keeps object alive: No              Yes             No
+Safe after free:    Yes (stale)     n/a             Yes
+
+
+### Measured cost
+The performance characteristics above are quantified at the end of
+main(): the "Measured" section times deref, copy, lock() and
+make_unique/make_shared per operation with the shared bench.h harness
+(ns/op, cycles/op, CSV), and benchmarks handles against all three
+smart pointer kinds.
+
 */
 
 #include <iostream>
 #include <memory>
 #include <string>
 #include <chrono>
+#include <vector>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "../bench.h"
 
 using namespace std;
 
+// === Generational handle pool ===
+
+template<typename T>
+class HandlePool
+{
+public:
+    struct Handle
+    {
+        uint32_t index;
+        uint32_t generation;
+    };
+
+private:
+    struct Slot
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+        uint32_t generation = 0;
+        bool occupied = false;
+    };
+
+    vector<Slot> slots;             // one contiguous slab
+    vector<uint32_t> freeIndices;
+    size_t liveObjects = 0;
+
+public:
+    explicit HandlePool(size_t capacity) : slots(capacity)
+    {
+        for (size_t i = capacity; i > 0; --i)
+        {
+            freeIndices.push_back((uint32_t)(i - 1));
+        }
+    }
+
+    ~HandlePool()
+    {
+        for (Slot& slot : slots)
+        {
+            if (slot.occupied)
+            {
+                ((T*)slot.storage)->~T();
+            }
+        }
+    }
+
+    template<typename... Args>
+    Handle create(Args&&... args)
+    {
+        if (freeIndices.empty())
+        {
+            return Handle{0xFFFFFFFF, 0};   // never validates
+        }
+        uint32_t index = freeIndices.back();
+        freeIndices.pop_back();
+        Slot& slot = slots[index];
+        new (slot.storage) T(std::forward<Args>(args)...);
+        slot.occupied = true;
+        liveObjects++;
+        return Handle{index, slot.generation};
+    }
+
+    // Two loads and a compare — the whole safety check
+    bool valid(Handle h) const
+    {
+        return h.index < slots.size() &&
+               slots[h.index].occupied &&
+               slots[h.index].generation == h.generation;
+    }
+
+    // nullptr for stale or destroyed handles, never a dangling pointer
+    T* get(Handle h)
+    {
+        return valid(h) ? (T*)slots[h.index].storage : nullptr;
+    }
+
+    // Bumping the generation invalidates every outstanding handle to
+    // this slot, even after the slot is reused
+    void destroy(Handle h)
+    {
+        if (!valid(h)) return;
+        Slot& slot = slots[h.index];
+        ((T*)slot.storage)->~T();
+        slot.occupied = false;
+        slot.generation++;
+        freeIndices.push_back(h.index);
+        liveObjects--;
+    }
+
+    // Memory-order walk over the slab, no pointer chasing
+    template<typename Fn>
+    void for_each(Fn fn)
+    {
+        for (Slot& slot : slots)
+        {
+            if (slot.occupied)
+            {
+                fn(*(T*)slot.storage);
+            }
+        }
+    }
+
+    size_t size() const { return liveObjects; }
+    size_t capacity() const { return slots.size(); }
+};
+
 class Resource
 {
 private:
@@ -355,6 +492,122 @@ int main()
     cout << "  Overhead ratio: " << (double)sharedDuration / uniqueDuration << "x" << endl;
     cout << endl;
 
+    cout << "=== Generational Handles ===" << endl;
+    {
+        HandlePool<int> pool(64);
+
+        auto h = pool.create(42);
+        cout << "Created handle {index " << h.index << ", gen "
+             << h.generation << "}, value " << *pool.get(h) << endl;
+
+        auto stale = h;
+        pool.destroy(h);
+        cout << "After destroy, stale handle valid? "
+             << (pool.valid(stale) ? "true (BUG)" : "false") << endl;
+        cout << "get(stale) returns "
+             << (pool.get(stale) == nullptr ? "nullptr" : "a pointer (BUG)")
+             << " — use-after-free caught without atomics" << endl;
+
+        // The slot is reused but the generation moved on, so the old
+        // handle still fails validation
+        auto reused = pool.create(99);
+        cout << "Slot reused as {index " << reused.index << ", gen "
+             << reused.generation << "}; stale handle still "
+             << (pool.valid(stale) ? "valid (BUG)" : "invalid") << endl;
+
+        for (int i = 0; i < 5; ++i) pool.create(i * 10);
+        cout << "Iteration in memory order:";
+        pool.for_each([](int& value) { cout << " " << value; });
+        cout << endl;
+    }
+    cout << endl;
+
+    // Same question at per-operation granularity, via the shared
+    // bench.h harness: warm-up, auto-scaled iterations, ns/op and
+    // cycles/op, plus CSV for regression tracking
+    cout << "=== Measured: Per-Operation Cost ===" << endl;
+    {
+        auto uptr = make_unique<int>(42);
+        auto sptr = make_shared<int>(42);
+        weak_ptr<int> wptr = sptr;
+        int* raw = uptr.get();
+
+        BENCH("raw pointer deref")
+        {
+            (void)bench_i;
+            bench::doNotOptimize(*raw);
+        };
+
+        BENCH("unique_ptr deref")
+        {
+            (void)bench_i;
+            bench::doNotOptimize(*uptr);
+        };
+
+        BENCH("shared_ptr deref")
+        {
+            (void)bench_i;
+            bench::doNotOptimize(*sptr);
+        };
+
+        BENCH("shared_ptr copy+destroy (2 atomic ops)")
+        {
+            (void)bench_i;
+            shared_ptr<int> copy = sptr;
+            bench::doNotOptimize(copy);
+        };
+
+        BENCH("weak_ptr lock+destroy")
+        {
+            (void)bench_i;
+            shared_ptr<int> locked = wptr.lock();
+            bench::doNotOptimize(locked);
+        };
+
+        BENCH("make_unique<int> + destroy")
+        {
+            (void)bench_i;
+            auto p = make_unique<int>(7);
+            bench::doNotOptimize(p);
+        };
+
+        BENCH("make_shared<int> + destroy")
+        {
+            (void)bench_i;
+            auto p = make_shared<int>(7);
+            bench::doNotOptimize(p);
+        };
+
+        HandlePool<int> pool(16);
+        auto handle = pool.create(42);
+
+        BENCH("handle validate + deref")
+        {
+            (void)bench_i;
+            int* p = pool.get(handle);
+            bench::doNotOptimize(*p);
+        };
+
+        BENCH("handle copy (plain 8-byte struct)")
+        {
+            (void)bench_i;
+            auto copy = handle;
+            bench::doNotOptimize(copy);
+        };
+
+        BENCH("handle create + destroy")
+        {
+            (void)bench_i;
+            auto h = pool.create(7);
+            bench::doNotOptimize(h);
+            pool.destroy(h);
+        };
+
+        bench::reportTable();
+        bench::reportCsv();
+    }
+    cout << endl;
+
     cout << "=== When to Use Each ===" << endl;
     
     cout << "\nuse unique_ptr for:" << endl;
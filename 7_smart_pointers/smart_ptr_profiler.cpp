@@ -0,0 +1,388 @@
+/*
+### SmartPtrProfiler — Finding the Cycles weak_ptr Was Meant to Break
+
+weak_ptr.cpp teaches cycle-breaking by hand, but a missed cycle in a
+large codebase leaks quietly until a soak test notices the RSS curve.
+This example is the instrumentation answer: an OPT-IN tracked factory
+plus a profiler that can name the leak.
+
+1. make_tracked<T>(args...) — a make_shared-style factory whose
+   deleter unregisters the object; every live tracked object sits in
+   a registry with its type, address range and size
+2. Edges are discovered CONSERVATIVELY: dump() scans each live
+   object's raw words and treats any word that lands inside another
+   live object's range as an ownership edge. A shared_ptr member
+   stores the raw T* right in the object, so cycles through
+   shared_ptr are found without any per-type hook (the same trick
+   leak scanners and conservative collectors use)
+3. Tarjan's algorithm over that graph flags strongly-connected
+   components — an SCC with more than one node, or a self-edge, is a
+   reference cycle no external release can reclaim
+4. dump() also aggregates live count and bytes per type, the first
+   thing to read in a canary that's gaining memory
+
+Costs land where they're tolerable: creation/destruction pay one
+mutex'd map operation (measured below), dump() is a stop-the-world
+walk you run on demand. Conservative scanning can report a FALSE
+edge if an integer happens to equal a live address — rare, and the
+failure mode is a spurious warning, never a missed release.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <typeinfo>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+using namespace std;
+
+// === The Registry and Profiler ===
+
+class SmartPtrProfiler
+{
+private:
+    struct LiveObject
+    {
+        const char* typeName;
+        size_t bytes;
+    };
+
+    // Ordered by address so interior words resolve with upper_bound
+    map<uintptr_t, LiveObject> live;
+    mutable mutex guard;
+
+    SmartPtrProfiler() = default;
+
+    static string demangle(const char* mangled)
+    {
+#if defined(__GNUC__)
+        int status = 0;
+        char* readable = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+        if (status == 0 && readable != nullptr)
+        {
+            string result = readable;
+            free(readable);
+            return result;
+        }
+#endif
+        return mangled;
+    }
+
+    // Which live object (if any) does this word point into?
+    // Expects guard to be held.
+    int ownerIndex(const vector<pair<uintptr_t, LiveObject>>& nodes,
+                   uintptr_t word) const
+    {
+        // Binary search the sorted snapshot: last base <= word
+        size_t lo = 0, hi = nodes.size();
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (nodes[mid].first <= word) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo == 0) return -1;
+        const auto& candidate = nodes[lo - 1];
+        if (word < candidate.first + candidate.second.bytes)
+        {
+            return (int)(lo - 1);
+        }
+        return -1;
+    }
+
+    // Iterative Tarjan SCC (explicit stack: graphs under inspection
+    // are exactly the ones too tangled to trust recursion depth on)
+    static vector<vector<int>> stronglyConnected(const vector<vector<int>>& adj)
+    {
+        int n = (int)adj.size();
+        vector<int> index(n, -1), lowLink(n, 0), onStack(n, 0);
+        vector<int> sccStack;
+        vector<vector<int>> components;
+        int nextIndex = 0;
+
+        struct Frame { int v; size_t edge; };
+        for (int start = 0; start < n; ++start)
+        {
+            if (index[start] != -1) continue;
+            vector<Frame> callStack{{start, 0}};
+            index[start] = lowLink[start] = nextIndex++;
+            sccStack.push_back(start);
+            onStack[start] = 1;
+
+            while (!callStack.empty())
+            {
+                Frame& frame = callStack.back();
+                if (frame.edge < adj[frame.v].size())
+                {
+                    int next = adj[frame.v][frame.edge++];
+                    if (index[next] == -1)
+                    {
+                        index[next] = lowLink[next] = nextIndex++;
+                        sccStack.push_back(next);
+                        onStack[next] = 1;
+                        callStack.push_back({next, 0});
+                    }
+                    else if (onStack[next])
+                    {
+                        lowLink[frame.v] = min(lowLink[frame.v], index[next]);
+                    }
+                }
+                else
+                {
+                    if (lowLink[frame.v] == index[frame.v])
+                    {
+                        vector<int> component;
+                        int member;
+                        do
+                        {
+                            member = sccStack.back();
+                            sccStack.pop_back();
+                            onStack[member] = 0;
+                            component.push_back(member);
+                        } while (member != frame.v);
+                        components.push_back(move(component));
+                    }
+                    int finished = frame.v;
+                    callStack.pop_back();
+                    if (!callStack.empty())
+                    {
+                        lowLink[callStack.back().v] =
+                            min(lowLink[callStack.back().v], lowLink[finished]);
+                    }
+                }
+            }
+        }
+        return components;
+    }
+
+public:
+    static SmartPtrProfiler& instance()
+    {
+        static SmartPtrProfiler profiler;
+        return profiler;
+    }
+
+    void registerObject(void* address, const char* typeName, size_t bytes)
+    {
+        lock_guard<mutex> lock(guard);
+        live[(uintptr_t)address] = LiveObject{typeName, bytes};
+    }
+
+    void unregisterObject(void* address)
+    {
+        lock_guard<mutex> lock(guard);
+        live.erase((uintptr_t)address);
+    }
+
+    size_t liveCount() const
+    {
+        lock_guard<mutex> lock(guard);
+        return live.size();
+    }
+
+    // Walk the ownership graph: per-type totals, then flag SCCs
+    void dump() const
+    {
+        lock_guard<mutex> lock(guard);
+
+        vector<pair<uintptr_t, LiveObject>> nodes(live.begin(), live.end());
+
+        cout << "--- SmartPtrProfiler dump: " << nodes.size()
+             << " live tracked object(s) ---" << endl;
+
+        // Per-type aggregation
+        map<string, pair<size_t, size_t>> perType;      // name -> {count, bytes}
+        for (const auto& node : nodes)
+        {
+            auto& entry = perType[demangle(node.second.typeName)];
+            entry.first += 1;
+            entry.second += node.second.bytes;
+        }
+        for (const auto& row : perType)
+        {
+            cout << "  " << setw(28) << left << row.first
+                 << right << setw(8) << row.second.first << " live"
+                 << setw(10) << row.second.second << " bytes" << endl;
+        }
+
+        // Conservative edge scan
+        vector<vector<int>> adj(nodes.size());
+        for (size_t from = 0; from < nodes.size(); ++from)
+        {
+            const uintptr_t* words = (const uintptr_t*)nodes[from].first;
+            size_t wordCount = nodes[from].second.bytes / sizeof(uintptr_t);
+            for (size_t w = 0; w < wordCount; ++w)
+            {
+                int to = ownerIndex(nodes, words[w]);
+                if (to >= 0 && (size_t)to != from)
+                {
+                    adj[from].push_back(to);
+                }
+                else if (to >= 0 && (size_t)to == from
+                      && words[w] != nodes[from].first)
+                {
+                    adj[from].push_back(to);    // true self-reference
+                }
+            }
+        }
+
+        // Cycle report
+        size_t cyclesFound = 0;
+        for (const auto& component : stronglyConnected(adj))
+        {
+            bool selfLoop = false;
+            if (component.size() == 1)
+            {
+                for (int to : adj[component[0]])
+                {
+                    if (to == component[0]) selfLoop = true;
+                }
+            }
+            if (component.size() > 1 || selfLoop)
+            {
+                ++cyclesFound;
+                cout << "  LEAKED CYCLE (" << component.size() << " object(s)): ";
+                for (int member : component)
+                {
+                    cout << demangle(nodes[member].second.typeName)
+                         << "@" << hex << nodes[member].first << dec << " ";
+                }
+                cout << endl;
+            }
+        }
+        if (cyclesFound == 0)
+        {
+            cout << "  no reference cycles among tracked objects" << endl;
+        }
+        cout << "--- end dump ---" << endl;
+    }
+};
+
+// The opt-in factory: same shape as make_shared, plus registration
+template<typename T, typename... Args>
+shared_ptr<T> make_tracked(Args&&... args)
+{
+    T* object = new T(forward<Args>(args)...);
+    SmartPtrProfiler::instance().registerObject(object, typeid(T).name(), sizeof(T));
+    return shared_ptr<T>(object, [](T* p) {
+        SmartPtrProfiler::instance().unregisterObject(p);
+        delete p;
+    });
+}
+
+// === Graph Types ===
+
+// Ownership edges must live in the OBJECT BODY for the word scan to
+// see them — a vector<shared_ptr<...>> member keeps its pointers in a
+// heap buffer the scan never visits. Direct shared_ptr members (the
+// common shape for parent/child links, and the shape every cycle in
+// weak_ptr.cpp has) are fully visible.
+struct Employee;
+
+struct Team
+{
+    string name;
+    shared_ptr<Employee> lead;                // owner -> member: fine
+    explicit Team(string n) : name(move(n)) {}
+};
+
+struct Employee
+{
+    string name;
+    shared_ptr<Team> team;                    // member -> owner: the bug
+    explicit Employee(string n) : name(move(n)) {}
+};
+
+struct SafeEmployee
+{
+    string name;
+    weak_ptr<Team> team;                      // the weak_ptr.cpp lesson
+    explicit SafeEmployee(string n) : name(move(n)) {}
+};
+
+int main()
+{
+    auto& profiler = SmartPtrProfiler::instance();
+
+    cout << "=== Example 1: The Missed Cycle, Caught ===" << endl;
+    {
+        {
+            auto team = make_tracked<Team>("platform");
+            auto alice = make_tracked<Employee>("alice");
+            auto bob = make_tracked<Employee>("bob");
+            alice->team = team;
+            team->lead = alice;               // Team <-> Employee cycle
+            bob->team = team;                 // one-way: bob is fine
+        }   // every external shared_ptr is gone here...
+
+        cout << "External owners released; tracked objects still live: "
+             << profiler.liveCount() << endl;
+        profiler.dump();
+        cout << "(Team <-> Employee keep each other alive — exactly the" << endl;
+        cout << " graph weak_ptr.cpp warns about, now visible in a report)" << endl;
+    }
+    cout << endl;
+
+    cout << "=== Example 2: The weak_ptr Fix Shows Clean ===" << endl;
+    {
+        {
+            auto team = make_tracked<Team>("infra");
+            auto carol = make_tracked<SafeEmployee>("carol");
+            carol->team = team;               // weak: no back-edge
+        }
+        cout << "After release, live tracked objects from this block: "
+             << "(only the leaked cycle from Example 1 remains)" << endl;
+        profiler.dump();
+    }
+    cout << endl;
+
+    cout << "=== Example 3: Tracking Overhead ===" << endl;
+    {
+        const int ROUNDS = 300000;
+
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < ROUNDS; ++i)
+        {
+            auto p = make_shared<Team>("t");
+        }
+        auto plainMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < ROUNDS; ++i)
+        {
+            auto p = make_tracked<Team>("t");
+        }
+        auto trackedMs = chrono::duration_cast<chrono::milliseconds>(
+            chrono::steady_clock::now() - start).count();
+
+        cout << ROUNDS << " create+destroy rounds:" << endl;
+        cout << "  make_shared:  " << plainMs << " ms" << endl;
+        cout << "  make_tracked: " << trackedMs << " ms" << endl;
+        cout << "Per object the delta is two mutex'd map operations. In a" << endl;
+        cout << "real service, where tracked objects do actual work between" << endl;
+        cout << "birth and death, that fixed cost is what makes leaving the" << endl;
+        cout << "profiler on in a canary affordable." << endl;
+    }
+    cout << endl;
+
+    cout << "=== Design Summary ===" << endl;
+    cout << "1. Opt-in: only make_tracked objects pay anything at all" << endl;
+    cout << "2. Edges found by conservative word scan — no per-type hooks" << endl;
+    cout << "3. Tarjan SCCs name the cycles; self-edges count too" << endl;
+    cout << "4. Per-type live counts and bytes: the canary's first question" << endl;
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+### Benchmark Harness
+
+A small Google-Benchmark-style harness for the *_comparison.cpp files,
+so their performance claims are measured instead of described:
+
+    BENCH("std::map probe")
+    {
+        sink += table.count(keys[bench_i % keys.size()]);
+    };
+
+    bench::reportTable();   // aligned human-readable table
+    bench::reportCsv();     // machine-readable, for tracking regressions
+
+What the harness does per benchmark:
+1. Warm-up pass so cold caches and lazy page-ins don't pollute run 1
+2. Iteration auto-scaling: the loop count grows until the benchmark
+   ran long enough (~25ms) for the clock to be trustworthy
+3. Reports ns/op from std::chrono and cycles/op from rdtsc
+4. bench::doNotOptimize() keeps the compiler from deleting the work
+
+The body runs once per iteration with `bench_i` as the iteration index
+(use it to vary keys without measuring a RNG).
+*/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+namespace bench
+{
+
+inline std::uint64_t readCycles()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    return __rdtsc();
+#else
+    return 0;                       // cycles/op reported as 0 off x86
+#endif
+}
+
+// Compiler barrier: makes a value "used" so the benchmarked work
+// cannot be optimized away
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    volatile const T* sink = &value;
+    (void)sink;
+#endif
+}
+
+struct Result
+{
+    std::string name;
+    double nsPerOp;
+    double cyclesPerOp;
+    std::uint64_t iterations;
+};
+
+inline std::vector<Result>& results()
+{
+    static std::vector<Result> all;
+    return all;
+}
+
+template<typename Fn>
+inline void runLoop(const char* name, Fn& fn)
+{
+    using clock = std::chrono::steady_clock;
+
+    // Warm-up: touch the data, train the branch predictor
+    for (std::uint64_t i = 0; i < 1000; ++i)
+    {
+        fn(i);
+    }
+
+    // Auto-scale iterations until the run is long enough to time
+    std::uint64_t iterations = 1000;
+    double elapsedNs = 0;
+    double elapsedCycles = 0;
+
+    while (true)
+    {
+        auto t0 = clock::now();
+        std::uint64_t c0 = readCycles();
+
+        for (std::uint64_t i = 0; i < iterations; ++i)
+        {
+            fn(i);
+        }
+
+        std::uint64_t c1 = readCycles();
+        elapsedNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            clock::now() - t0).count();
+        elapsedCycles = (double)(c1 - c0);
+
+        if (elapsedNs >= 25e6 || iterations >= (1ull << 30))
+        {
+            break;
+        }
+        iterations *= 4;
+    }
+
+    results().push_back(Result{
+        name,
+        elapsedNs / (double)iterations,
+        elapsedCycles / (double)iterations,
+        iterations
+    });
+}
+
+// BENCH(name) { body }; expands through this helper so the body can
+// be written as a block
+struct Registrar
+{
+    const char* name;
+
+    template<typename Fn>
+    void operator=(Fn&& fn)
+    {
+        runLoop(name, fn);
+    }
+};
+
+inline void reportTable()
+{
+    std::printf("\n%-44s %12s %12s %12s\n", "benchmark", "ns/op", "cycles/op", "iterations");
+    std::printf("%-44s %12s %12s %12s\n", "---------", "-----", "---------", "----------");
+    for (const Result& r : results())
+    {
+        std::printf("%-44s %12.1f %12.1f %12llu\n",
+                    r.name.c_str(), r.nsPerOp, r.cyclesPerOp,
+                    (unsigned long long)r.iterations);
+    }
+}
+
+inline void reportCsv()
+{
+    std::printf("\nCSV:\nname,ns_per_op,cycles_per_op,iterations\n");
+    for (const Result& r : results())
+    {
+        std::printf("%s,%.2f,%.2f,%llu\n",
+                    r.name.c_str(), r.nsPerOp, r.cyclesPerOp,
+                    (unsigned long long)r.iterations);
+    }
+}
+
+} // namespace bench
+
+#define BENCH(name) bench::Registrar{name} = [&](std::uint64_t bench_i)
+
+#endif // BENCH_H
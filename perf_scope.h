@@ -0,0 +1,230 @@
+/*
+### perf_scope.h — Hot-Path Latency Histograms
+
+bench.h answers "how fast is this loop in isolation"; this header
+answers "where does time go while the program actually runs". Drop
+PERF_SCOPE("name") at the top of any block:
+
+    void lookup(...)
+    {
+        PERF_SCOPE("map.lookup");
+        ...
+    }
+
+and every execution records an rdtsc delta into a log-bucketed
+histogram. Perf::dump() prints count / p50 / p99 / p999 / max per
+scope — the shape of the tail, not just the mean.
+
+### Costs
+- Enabled (#define PERF_SCOPE_ENABLED before including): two rdtsc
+  reads and one array increment per scope; histograms are THREAD
+  LOCAL so recording never takes a lock, and fixed-size (64 exponent
+  buckets x 16 linear sub-buckets x 4 bytes = 4 KB each) so memory
+  can't grow with load
+- Disabled (default): the macro expands to nothing — release builds
+  pay zero unless they opt in
+
+### HDR-style bucketing
+bucket = (bit width of delta, top 4 bits below the leading bit).
+Relative error is bounded at ~6% per bucket, which is plenty to
+tell a 2x p999 regression from noise, and the whole range of a
+64-bit cycle count fits in fixed memory.
+*/
+
+#ifndef PERF_SCOPE_H
+#define PERF_SCOPE_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+namespace Perf
+{
+    inline std::uint64_t readCycles()
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+        return __rdtsc();
+#else
+        return (std::uint64_t)std::chrono::steady_clock::now()
+            .time_since_epoch().count();
+#endif
+    }
+
+    constexpr std::size_t EXP_BUCKETS = 64;
+    constexpr std::size_t SUB_BUCKETS = 16;
+
+    class Histogram
+    {
+    private:
+        std::uint32_t counts[EXP_BUCKETS * SUB_BUCKETS] = {};
+        std::uint64_t total = 0;
+        std::uint64_t maxSeen = 0;
+
+        static std::size_t bucketOf(std::uint64_t delta)
+        {
+            if (delta < SUB_BUCKETS)
+            {
+                return (std::size_t)delta;       // exact below 16 cycles
+            }
+            std::size_t exponent = 63 - (std::size_t)__builtin_clzll(delta);
+            std::size_t sub = (std::size_t)((delta >> (exponent - 4)) & 0xF);
+            return exponent * SUB_BUCKETS + sub;
+        }
+
+        // Representative value for a bucket: its lower edge
+        static std::uint64_t valueOf(std::size_t bucket)
+        {
+            std::size_t exponent = bucket / SUB_BUCKETS;
+            std::size_t sub = bucket % SUB_BUCKETS;
+            if (exponent == 0)
+            {
+                return sub;
+            }
+            return ((std::uint64_t)1 << exponent)
+                 | ((std::uint64_t)sub << (exponent - 4));
+        }
+
+    public:
+        void record(std::uint64_t delta)
+        {
+            counts[bucketOf(delta)]++;
+            total++;
+            if (delta > maxSeen) maxSeen = delta;
+        }
+
+        void merge(const Histogram& other)
+        {
+            for (std::size_t i = 0; i < EXP_BUCKETS * SUB_BUCKETS; ++i)
+            {
+                counts[i] += other.counts[i];
+            }
+            total += other.total;
+            if (other.maxSeen > maxSeen) maxSeen = other.maxSeen;
+        }
+
+        std::uint64_t count() const { return total; }
+        std::uint64_t maxValue() const { return maxSeen; }
+
+        std::uint64_t percentile(double p) const
+        {
+            if (total == 0) return 0;
+            std::uint64_t rank = (std::uint64_t)(p * (double)total / 100.0);
+            if (rank >= total) rank = total - 1;
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < EXP_BUCKETS * SUB_BUCKETS; ++i)
+            {
+                seen += counts[i];
+                if (seen > rank)
+                {
+                    return valueOf(i);
+                }
+            }
+            return maxSeen;
+        }
+    };
+
+    // Scope names -> per-thread histograms; merged at dump time so the
+    // record path never synchronizes
+    class Registry
+    {
+    private:
+        std::map<std::string, std::vector<const Histogram*>> scopes;
+        std::mutex guard;
+
+        Registry() = default;
+
+    public:
+        static Registry& instance()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        // Called once per (scope, thread) from the macro's static init
+        Histogram* adopt(const char* name)
+        {
+            // Leaked intentionally: threads may outlive any sensible
+            // teardown order, and one 4 KB histogram per scope-thread
+            // pair for the process lifetime is the documented cost
+            Histogram* hist = new Histogram();
+            std::lock_guard<std::mutex> lock(guard);
+            scopes[name].push_back(hist);
+            return hist;
+        }
+
+        void dump(std::ostream& out = std::cout)
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            out << "--- perf scopes (cycles) ---" << std::endl;
+            out << std::left << std::setw(26) << "scope"
+                << std::right << std::setw(10) << "count"
+                << std::setw(10) << "p50"
+                << std::setw(10) << "p99"
+                << std::setw(10) << "p999"
+                << std::setw(12) << "max" << std::endl;
+            for (const auto& scope : scopes)
+            {
+                Histogram merged;
+                for (const Histogram* hist : scope.second)
+                {
+                    merged.merge(*hist);
+                }
+                out << std::left << std::setw(26) << scope.first
+                    << std::right << std::setw(10) << merged.count()
+                    << std::setw(10) << merged.percentile(50)
+                    << std::setw(10) << merged.percentile(99)
+                    << std::setw(10) << merged.percentile(99.9)
+                    << std::setw(12) << merged.maxValue() << std::endl;
+            }
+            out << "--- end perf scopes ---" << std::endl;
+        }
+    };
+
+    inline void dump() { Registry::instance().dump(); }
+
+    class ScopeTimer
+    {
+    private:
+        Histogram* hist;
+        std::uint64_t start;
+
+    public:
+        explicit ScopeTimer(Histogram* h) : hist(h), start(readCycles()) {}
+
+        ~ScopeTimer()
+        {
+            hist->record(readCycles() - start);
+        }
+
+        ScopeTimer(const ScopeTimer&) = delete;
+        ScopeTimer& operator=(const ScopeTimer&) = delete;
+    };
+
+} // namespace Perf
+
+// Two-level expansion so __LINE__ pastes into unique identifiers
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+
+#if defined(PERF_SCOPE_ENABLED)
+#define PERF_SCOPE(name)                                                      \
+    static thread_local Perf::Histogram* PERF_CONCAT(perfHist_, __LINE__) =   \
+        Perf::Registry::instance().adopt(name);                               \
+    Perf::ScopeTimer PERF_CONCAT(perfScope_, __LINE__)(                       \
+        PERF_CONCAT(perfHist_, __LINE__))
+#else
+#define PERF_SCOPE(name) ((void)0)
+#endif
+
+#endif // PERF_SCOPE_H
@@ -0,0 +1,402 @@
+/*
+### persist.h — Memory-Mapped Persistence for Packed Containers
+
+Shared by the examples the way bench.h is. The containers here are
+rebuilt from scratch on every process start; for large read-mostly
+reference data the rebuild IS the startup time. This header writes a
+container's packed arrays into a relocatable on-disk format and
+reopens them by MEMORY MAPPING — no deserialization pass at all, the
+OS faults pages in lazily on first access.
+
+File format (little-endian, offset-based, no pointers):
+    FileHeader      magic, version, section count
+    SectionEntry[]  name, byte offset from file start, bytes, elements
+    ...padding...
+    sections        each one page-aligned (4096), raw element arrays
+
+Because every reference is an offset from the file start, the mapping
+address doesn't matter — the file is relocatable.
+
+Pieces:
+1. Writer — addSection(name, data, count) then finish(path)
+2. MappedFile — cross-platform read-only mapping (mmap / MapViewOfFile)
+3. MappedFlatMap<Key, Value> — the flat_map lookup API (find/contains/
+   lower_bound-style probes) over the mapped key/value sections
+4. MappedChunkedVector<T> — indexed read-only view over a section
+   (ChunkedVector's chunks are written out contiguously, so the view
+   is a flat array: operator[] is one load, no chunk table)
+
+Only trivially copyable element types can be persisted this way —
+anything with owning pointers has no meaning in another process.
+*/
+
+#ifndef PERSIST_H
+#define PERSIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Persist
+{
+    constexpr std::uint64_t MAGIC = 0x5453495352455050ull;   // "PPERSIST"
+    constexpr std::uint32_t VERSION = 1;
+    constexpr std::size_t PAGE_SIZE = 4096;
+    constexpr std::size_t NAME_BYTES = 16;
+
+    struct FileHeader
+    {
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint32_t sectionCount;
+    };
+
+    struct SectionEntry
+    {
+        char name[NAME_BYTES];
+        std::uint64_t offset;           // bytes from file start, page-aligned
+        std::uint64_t byteCount;
+        std::uint64_t elementCount;
+    };
+
+    inline std::size_t pageAlign(std::size_t offset)
+    {
+        return (offset + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    }
+
+    // ### Writer — builds the file section by section
+    class Writer
+    {
+    private:
+        struct Pending
+        {
+            std::string name;
+            std::vector<unsigned char> bytes;
+            std::uint64_t elementCount;
+        };
+        std::vector<Pending> sections;
+
+    public:
+        template<typename T>
+        void addSection(const std::string& name, const T* data, std::size_t count)
+        {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "persisted sections must be trivially copyable");
+            if (name.size() >= NAME_BYTES)
+            {
+                throw std::runtime_error("section name too long: " + name);
+            }
+            Pending p;
+            p.name = name;
+            p.bytes.resize(count * sizeof(T));
+            std::memcpy(p.bytes.data(), data, count * sizeof(T));
+            p.elementCount = count;
+            sections.push_back(std::move(p));
+        }
+
+        void finish(const std::string& path) const
+        {
+            FileHeader header{MAGIC, VERSION, (std::uint32_t)sections.size()};
+
+            // Lay out: header, table, then page-aligned sections
+            std::vector<SectionEntry> table(sections.size());
+            std::size_t cursor = sizeof(FileHeader)
+                               + sizeof(SectionEntry) * sections.size();
+            for (std::size_t i = 0; i < sections.size(); ++i)
+            {
+                cursor = pageAlign(cursor);
+                std::memset(table[i].name, 0, NAME_BYTES);
+                std::memcpy(table[i].name, sections[i].name.c_str(),
+                            sections[i].name.size());
+                table[i].offset = cursor;
+                table[i].byteCount = sections[i].bytes.size();
+                table[i].elementCount = sections[i].elementCount;
+                cursor += sections[i].bytes.size();
+            }
+
+            std::FILE* out = std::fopen(path.c_str(), "wb");
+            if (out == nullptr)
+            {
+                throw std::runtime_error("cannot create " + path);
+            }
+            std::fwrite(&header, sizeof(header), 1, out);
+            std::fwrite(table.data(), sizeof(SectionEntry), table.size(), out);
+
+            std::size_t written = sizeof(FileHeader)
+                                + sizeof(SectionEntry) * sections.size();
+            for (std::size_t i = 0; i < sections.size(); ++i)
+            {
+                // Zero-pad up to the section's page-aligned offset
+                static const unsigned char zeros[PAGE_SIZE] = {};
+                while (written < table[i].offset)
+                {
+                    std::size_t pad = table[i].offset - written;
+                    if (pad > PAGE_SIZE) pad = PAGE_SIZE;
+                    std::fwrite(zeros, 1, pad, out);
+                    written += pad;
+                }
+                std::fwrite(sections[i].bytes.data(), 1,
+                            sections[i].bytes.size(), out);
+                written += sections[i].bytes.size();
+            }
+            if (std::fclose(out) != 0)
+            {
+                throw std::runtime_error("write failed for " + path);
+            }
+        }
+    };
+
+    // ### MappedFile — read-only view of a finished file
+    class MappedFile
+    {
+    private:
+        const unsigned char* base = nullptr;
+        std::size_t length = 0;
+#if defined(_WIN32)
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#else
+        int fd = -1;
+#endif
+
+        const FileHeader& header() const
+        {
+            return *reinterpret_cast<const FileHeader*>(base);
+        }
+
+        const SectionEntry* table() const
+        {
+            return reinterpret_cast<const SectionEntry*>(base + sizeof(FileHeader));
+        }
+
+    public:
+        explicit MappedFile(const std::string& path)
+        {
+#if defined(_WIN32)
+            file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                               nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                throw std::runtime_error("cannot open " + path);
+            }
+            LARGE_INTEGER size;
+            GetFileSizeEx(file, &size);
+            length = (std::size_t)size.QuadPart;
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping == nullptr)
+            {
+                CloseHandle(file);
+                throw std::runtime_error("cannot map " + path);
+            }
+            base = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (base == nullptr)
+            {
+                CloseHandle(mapping);
+                CloseHandle(file);
+                throw std::runtime_error("cannot map view of " + path);
+            }
+#else
+            fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                throw std::runtime_error("cannot open " + path);
+            }
+            struct stat st;
+            if (::fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                throw std::runtime_error("cannot stat " + path);
+            }
+            length = (std::size_t)st.st_size;
+            void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("cannot mmap " + path);
+            }
+            base = (const unsigned char*)mapped;
+#endif
+            if (length < sizeof(FileHeader) || header().magic != MAGIC)
+            {
+                throw std::runtime_error(path + " is not a persist file");
+            }
+            if (header().version != VERSION)
+            {
+                throw std::runtime_error(path + ": unsupported format version");
+            }
+        }
+
+        ~MappedFile()
+        {
+#if defined(_WIN32)
+            if (base != nullptr) UnmapViewOfFile((LPCVOID)base);
+            if (mapping != nullptr) CloseHandle(mapping);
+            if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+            if (base != nullptr) ::munmap((void*)base, length);
+            if (fd >= 0) ::close(fd);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        struct Section
+        {
+            const void* data;
+            std::size_t byteCount;
+            std::size_t elementCount;
+        };
+
+        Section section(const std::string& name) const
+        {
+            const SectionEntry* entries = table();
+            for (std::uint32_t i = 0; i < header().sectionCount; ++i)
+            {
+                if (std::strncmp(entries[i].name, name.c_str(), NAME_BYTES) == 0)
+                {
+                    return Section{base + entries[i].offset,
+                                   (std::size_t)entries[i].byteCount,
+                                   (std::size_t)entries[i].elementCount};
+                }
+            }
+            throw std::runtime_error("no section named " + name);
+        }
+
+        template<typename T>
+        const T* sectionData(const std::string& name, std::size_t& countOut) const
+        {
+            Section s = section(name);
+            if (s.byteCount != s.elementCount * sizeof(T))
+            {
+                throw std::runtime_error("section " + name + " element size mismatch");
+            }
+            countOut = s.elementCount;
+            return reinterpret_cast<const T*>(s.data);
+        }
+
+        std::size_t fileBytes() const { return length; }
+    };
+
+    // ### MappedFlatMap — flat_map's probe API over mapped sections.
+    // Nothing is copied at open: find() binary-searches the key array
+    // in place and the pages it touches fault in on demand.
+    template<typename Key, typename Value>
+    class MappedFlatMap
+    {
+    private:
+        const Key* keyArray = nullptr;
+        const Value* valueArray = nullptr;
+        std::size_t count = 0;
+
+        // Same branchless narrowing as flat_map::lowerBoundIndex, with
+        // a plain linear tail (the mapped view stays ISA-neutral)
+        std::size_t lowerBoundIndex(const Key& key) const
+        {
+            std::size_t base = 0;
+            std::size_t length = count;
+            while (length > 8)
+            {
+                std::size_t half = length / 2;
+                base += (keyArray[base + half - 1] < key) ? half : 0;
+                length -= half;
+            }
+            std::size_t i = 0;
+            while (i < length && keyArray[base + i] < key)
+            {
+                ++i;
+            }
+            return base + i;
+        }
+
+    public:
+        explicit MappedFlatMap(const MappedFile& file)
+        {
+            static_assert(std::is_trivially_copyable_v<Key>
+                       && std::is_trivially_copyable_v<Value>,
+                          "mapped maps hold trivially copyable types");
+            std::size_t keyCount = 0, valueCount = 0;
+            keyArray = file.sectionData<Key>("keys", keyCount);
+            valueArray = file.sectionData<Value>("values", valueCount);
+            if (keyCount != valueCount)
+            {
+                throw std::runtime_error("keys/values section length mismatch");
+            }
+            count = keyCount;
+        }
+
+        std::size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        const Value* find(const Key& key) const
+        {
+            std::size_t i = lowerBoundIndex(key);
+            if (i < count && !(key < keyArray[i]))
+            {
+                return &valueArray[i];
+            }
+            return nullptr;
+        }
+
+        bool contains(const Key& key) const { return find(key) != nullptr; }
+
+        // Visit every entry with lo <= key < hi, flat_map style
+        template<typename Fn>
+        void for_each_range(const Key& lo, const Key& hi, Fn fn) const
+        {
+            std::size_t begin = lowerBoundIndex(lo);
+            std::size_t end = lowerBoundIndex(hi);
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                fn(keyArray[i], valueArray[i]);
+            }
+        }
+
+        const Key* keys() const { return keyArray; }
+        const Value* values() const { return valueArray; }
+    };
+
+    // ### MappedChunkedVector — ChunkedVector written out contiguously
+    // becomes a flat read-only array: operator[] is one load, no chunk
+    // table indirection
+    template<typename T>
+    class MappedChunkedVector
+    {
+    private:
+        const T* elements = nullptr;
+        std::size_t count = 0;
+
+    public:
+        explicit MappedChunkedVector(const MappedFile& file)
+        {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "mapped vectors hold trivially copyable types");
+            elements = file.sectionData<T>("data", count);
+        }
+
+        std::size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        const T& operator[](std::size_t index) const { return elements[index]; }
+
+        const T* begin() const { return elements; }
+        const T* end() const { return elements + count; }
+    };
+
+} // namespace Persist
+
+#endif // PERSIST_H